@@ -0,0 +1,310 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the asynchronous logger
+*/
+
+#include "AsyncLog.h"
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// how long the writer thread sleeps when every ring is empty
+static const int LOG_IDLE_MS = 2;
+
+// single producer (owning thread) / single consumer (writer thread) ring;
+// head and tail count records ever popped / pushed
+struct LogRing
+{
+    unsigned tid;
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> tail;
+    LogRecord records[AsyncLog::RING_SIZE];
+
+    explicit LogRing(unsigned id) : tid(id), head(0), tail(0) {}
+};
+
+static const std::chrono::steady_clock::time_point logEpoch = std::chrono::steady_clock::now();
+
+static uint64_t logNow()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - logEpoch).count());
+}
+
+// formats {} placeholders, see AsyncLog.h
+static void formatText(const LogRecord& r, std::string& out)
+{
+    char number[64];
+    int next = 0;
+    for (const char* p = r.format; *p; ++p)
+    {
+        if (*p != '{')
+        {
+            out += *p;
+            continue;
+        }
+        const char* close = std::strchr(p, '}');
+        if (!close)
+        {
+            out += p;
+            break;
+        }
+
+        // {width.precision}, both optional
+        int width = static_cast<int>(std::strtol(p + 1, nullptr, 10));
+        const char* dot = static_cast<const char*>(std::memchr(p, '.', close - p));
+        double value = (next < r.count) ? r.values[next++] : 0.0;
+        if (dot)
+        {
+            int precision = static_cast<int>(std::strtol(dot + 1, nullptr, 10));
+            std::snprintf(number, sizeof(number), "%*.*f", width, precision, value);
+        }
+        else
+        {
+            std::snprintf(number, sizeof(number), "%*g", width, value);
+        }
+        out += number;
+        p = close;
+    }
+    out += '\n';
+}
+
+// the writer thread and the registry of per-thread rings
+class LogBackend
+{
+public:
+    LogBackend() : telemetryFile(nullptr), stopping(false), dropped(0) {}
+
+    ~LogBackend()
+    {
+        stopping.store(true);
+        if (writer.joinable())
+        {
+            writer.join();
+        }
+        drain();
+        std::fflush(stdout);
+        if (telemetryFile)
+        {
+            std::fclose(telemetryFile);
+        }
+    }
+
+    // first record on this thread: create its ring (and the writer on first use)
+    LogRing* registerThread()
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        LogRing* ring = new LogRing(static_cast<unsigned>(rings.size()));
+        rings.push_back(ring);
+        if (!writer.joinable())
+        {
+            writer = std::thread(&LogBackend::writerLoop, this);
+        }
+        return ring;
+    }
+
+    // format and write everything queued, returns true if anything was written
+    bool drain()
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        newHeads.resize(rings.size());
+        bool any = false;
+        for (size_t r = 0; r < rings.size(); ++r)
+        {
+            LogRing* ring = rings[r];
+            uint64_t head = ring->head.load(std::memory_order_relaxed);
+            uint64_t tail = ring->tail.load(std::memory_order_acquire);
+            any = any || head < tail;
+            for (; head < tail; ++head)
+            {
+                write(*ring, ring->records[head % AsyncLog::RING_SIZE]);
+            }
+            newHeads[r] = head;
+        }
+        if (!any)
+        {
+            return false;
+        }
+
+        std::fwrite(line.data(), 1, line.size(), stdout);
+        line.clear();
+
+        // release the slots only once written, flush() waits on the heads
+        for (size_t r = 0; r < rings.size(); ++r)
+        {
+            rings[r]->head.store(newHeads[r], std::memory_order_release);
+        }
+        return true;
+    }
+
+    // swap the telemetry file, never while a drain is writing to it
+    void setTelemetry(FILE* csv)
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        FILE* previous = telemetryFile.exchange(csv);
+        if (previous)
+        {
+            std::fclose(previous);
+        }
+    }
+
+    // block until every ring has been drained up to its current tail
+    void flush()
+    {
+        std::vector<std::pair<LogRing*, uint64_t> > targets;
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            for (LogRing* ring : rings)
+            {
+                targets.push_back(std::make_pair(ring, ring->tail.load(std::memory_order_acquire)));
+            }
+        }
+        for (const auto& target : targets)
+        {
+            while (target.first->head.load(std::memory_order_acquire) < target.second)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        }
+        std::fflush(stdout);
+        if (telemetryFile)
+        {
+            std::fflush(telemetryFile);
+        }
+    }
+
+    // wake the writer early (a ring is filling up) instead of waiting out its sleep
+    void wake()
+    {
+        wakeCv.notify_one();
+    }
+
+    std::atomic<FILE*> telemetryFile;
+    std::atomic<bool> stopping;
+    std::atomic<unsigned long long> dropped;
+
+private:
+    void write(const LogRing& ring, const LogRecord& r)
+    {
+        if (!r.telemetry)
+        {
+            formatText(r, line);
+            return;
+        }
+
+        FILE* csv = telemetryFile.load();
+        if (!csv)
+        {
+            return;
+        }
+        std::fprintf(csv, "%.6f,%u,%s", r.time * 1e-9, ring.tid, r.format);
+        for (int i = 0; i < r.count; ++i)
+        {
+            std::fprintf(csv, ",%.9g", r.values[i]);
+        }
+        std::fputc('\n', csv);
+    }
+
+    void writerLoop()
+    {
+        std::mutex idleMutex;
+        while (!stopping.load())
+        {
+            if (!drain())
+            {
+                std::unique_lock<std::mutex> lock(idleMutex);
+                wakeCv.wait_for(lock, std::chrono::milliseconds(LOG_IDLE_MS));
+            }
+        }
+    }
+
+    std::mutex ringsMutex; // held while draining and registering, never by push
+    std::vector<LogRing*> rings;
+    std::thread writer;
+    std::condition_variable wakeCv;
+    std::string line;      // formatted text of the current drain
+    std::vector<uint64_t> newHeads;
+};
+
+static LogBackend backend;
+static thread_local LogRing* threadRing = nullptr;
+
+void AsyncLog::push(const char* format, uint8_t telemetry, const double* values, size_t count)
+{
+    LogRing* ring = threadRing;
+    if (!ring)
+    {
+        ring = threadRing = backend.registerThread();
+    }
+
+    uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+    uint64_t queued = tail - ring->head.load(std::memory_order_acquire);
+    // telemetry may only fill 3/4 of the ring, a burst of rows never starves text lines
+    const uint64_t limit = telemetry ? RING_SIZE - RING_SIZE / 4 : RING_SIZE;
+    if (queued >= limit)
+    {
+        backend.dropped.fetch_add(1, std::memory_order_relaxed); // writer behind, never wait
+        return;
+    }
+
+    LogRecord& r = ring->records[tail % RING_SIZE];
+    r.format = format;
+    r.time = logNow();
+    r.thread = ring->tid;
+    r.telemetry = telemetry;
+    r.count = static_cast<uint8_t>(count < static_cast<size_t>(LogRecord::MAX_VALUES) ? count : LogRecord::MAX_VALUES);
+    std::memcpy(r.values, values, r.count * sizeof(double));
+    ring->tail.store(tail + 1, std::memory_order_release);
+
+    if (queued == RING_SIZE / 2)
+    {
+        backend.wake();
+    }
+}
+
+bool AsyncLog::openTelemetry(const std::string& path)
+{
+    FILE* csv = std::fopen(path.c_str(), "w");
+    if (!csv)
+    {
+        return false;
+    }
+    std::fprintf(csv, "time,thread,channel,values...\n");
+    flush(); // rows logged before the switch go to the old file
+    backend.setTelemetry(csv);
+    return true;
+}
+
+bool AsyncLog::telemetryEnabled()
+{
+    return backend.telemetryFile.load() != nullptr;
+}
+
+void AsyncLog::flush()
+{
+    backend.flush();
+}
+
+unsigned long long AsyncLog::droppedCount()
+{
+    return backend.dropped.load();
+}
+
+LogRateLimiter::LogRateLimiter(double seconds)
+    : interval(static_cast<uint64_t>(seconds * 1e9)), next(0)
+{
+}
+
+bool LogRateLimiter::allow()
+{
+    uint64_t now = logNow();
+    uint64_t due = next.load(std::memory_order_relaxed);
+    return now >= due && next.compare_exchange_strong(due, now + interval, std::memory_order_relaxed);
+}
@@ -0,0 +1,100 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the asynchronous logger. A log call only copies a
+format string pointer and up to MAX_VALUES numbers into a ring buffer owned by
+the calling thread (no locks, no formatting); a background thread formats the
+records and writes text to stdout and telemetry rows to a CSV file. If a ring
+is full the record is dropped and counted rather than blocking the caller;
+telemetry rows leave a quarter of the ring free for text lines.
+
+Text formats use {} placeholders filled from the values in order:
+    {}     shortest form (%g)
+    {.2}   fixed, 2 decimals
+    {5.2}  fixed, 2 decimals, right aligned in 5 characters
+Format strings and channel names must be string literals (stored by pointer).
+*/
+
+#ifndef ASYNC_LOG_H
+#define ASYNC_LOG_H
+
+#include <atomic>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+struct LogRecord
+{
+    static const int MAX_VALUES = 16;
+
+    const char* format;   // text format, or telemetry channel name
+    uint64_t time;        // ns since the logger started
+    uint32_t thread;
+    uint8_t telemetry;    // 1 = CSV row, 0 = text line
+    uint8_t count;
+    double values[MAX_VALUES];
+};
+
+class AsyncLog
+{
+public:
+    // records buffered per thread
+    static const size_t RING_SIZE = 8192;
+
+    // text line, e.g. AsyncLog::text("Reached waypoint {} (distance: {.2})", index, distance)
+    template <class... Values>
+    static void text(const char* format, Values... values)
+    {
+        const double packed[] = { 0.0, static_cast<double>(values)... };
+        push(format, 0, packed + 1, sizeof...(values));
+    }
+
+    // CSV row "time,thread,channel,values..." in the telemetry file (dropped if none is open)
+    template <class... Values>
+    static void telemetry(const char* channel, Values... values)
+    {
+        const double packed[] = { 0.0, static_cast<double>(values)... };
+        push(channel, 1, packed + 1, sizeof...(values));
+    }
+
+    // start writing telemetry rows to path, returns false if it cannot be created
+    static bool openTelemetry(const std::string& path);
+    static bool telemetryEnabled();
+
+    // wait until everything logged so far has been written
+    static void flush();
+
+    // records lost to full rings
+    static unsigned long long droppedCount();
+
+private:
+    static void push(const char* format, uint8_t telemetry, const double* values, size_t count);
+};
+
+// lets a log call through at most once per interval (wall time), e.g.
+//     static LogRateLimiter limiter(0.5);
+//     if (limiter.allow()) AsyncLog::text(...);
+class LogRateLimiter
+{
+public:
+    explicit LogRateLimiter(double seconds);
+    bool allow();
+
+private:
+    uint64_t interval;
+    std::atomic<uint64_t> next;
+};
+
+// rate limited text line, one limiter per call site
+#define LOG_TEXT_EVERY(seconds, ...)                      \
+    do                                                    \
+    {                                                     \
+        static LogRateLimiter logLimiter(seconds);        \
+        if (logLimiter.allow())                           \
+        {                                                 \
+            AsyncLog::text(__VA_ARGS__);                  \
+        }                                                 \
+    } while (0)
+
+#endif
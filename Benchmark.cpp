@@ -0,0 +1,265 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the uav_bench harness
+*/
+
+#include "Benchmark.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <map>
+#include <cstdlib>
+
+struct RegisteredBenchmark
+{
+    std::string name;
+    BenchFunction fn;
+    std::vector<long long> args;
+};
+
+struct BenchResult
+{
+    std::string name;
+    unsigned long long iterations;
+    double nsPerIteration;
+    double nsPerItem;     // 0 when the benchmark reports no items
+    double itemsPerSecond;
+    double bytesPerSecond;
+    std::string label;
+    std::string error;
+};
+
+// function-local so registration from other translation units is order safe
+static std::vector<RegisteredBenchmark>& registry()
+{
+    static std::vector<RegisteredBenchmark> benchmarks;
+    return benchmarks;
+}
+
+// stop growing the iteration count past this
+static const unsigned long long MAX_ITERATIONS = 1000000000ULL;
+
+BenchState::BenchState(long long arg, unsigned long long iterations)
+    : itemsProcessed(0.0), bytesProcessed(0.0), arg(arg), iterations(iterations), remaining(iterations)
+{
+}
+
+double BenchState::elapsedSeconds() const
+{
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+int registerBenchmark(const char* name, BenchFunction fn, const std::vector<long long>& args)
+{
+    RegisteredBenchmark bench;
+    bench.name = name;
+    bench.fn = fn;
+    bench.args = args;
+    registry().push_back(bench);
+    return static_cast<int>(registry().size());
+}
+
+// run one benchmark instance with more iterations until it lasts minTime
+static BenchResult runOne(const std::string& name, BenchFunction fn, long long arg, double minTime)
+{
+    unsigned long long iterations = 1;
+    while (true)
+    {
+        BenchState state(arg, iterations);
+        fn(state);
+        double seconds = state.elapsedSeconds();
+
+        if (seconds >= minTime || iterations >= MAX_ITERATIONS)
+        {
+            BenchResult result;
+            result.name = name;
+            result.iterations = iterations;
+            result.nsPerIteration = seconds * 1e9 / iterations;
+            result.nsPerItem = (state.itemsProcessed > 0.0) ? seconds * 1e9 / state.itemsProcessed : 0.0;
+            result.itemsPerSecond = (seconds > 0.0) ? state.itemsProcessed / seconds : 0.0;
+            result.bytesPerSecond = (seconds > 0.0) ? state.bytesProcessed / seconds : 0.0;
+            result.label = state.label;
+            result.error = state.error;
+            return result;
+        }
+
+        // aim a little past minTime, grow at most 10x per round
+        double scale = (seconds > 0.0) ? minTime * 1.4 / seconds : 10.0;
+        if (scale > 10.0) scale = 10.0;
+        if (scale < 2.0) scale = 2.0;
+        iterations = static_cast<unsigned long long>(iterations * scale);
+        if (iterations > MAX_ITERATIONS) iterations = MAX_ITERATIONS;
+    }
+}
+
+// human readable rate, e.g. 12.3M/s
+static std::string formatRate(double perSecond)
+{
+    const char* suffix = "";
+    if (perSecond >= 1e9) { perSecond /= 1e9; suffix = "G"; }
+    else if (perSecond >= 1e6) { perSecond /= 1e6; suffix = "M"; }
+    else if (perSecond >= 1e3) { perSecond /= 1e3; suffix = "k"; }
+
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2) << perSecond << suffix << "/s";
+    return out.str();
+}
+
+static void printResult(const BenchResult& r)
+{
+    std::cout << std::left << std::setw(36) << r.name << std::right
+              << std::fixed << std::setprecision(1) << std::setw(14) << r.nsPerIteration << " ns"
+              << std::setw(12) << r.iterations;
+    if (r.nsPerItem > 0.0)
+    {
+        std::cout << std::setprecision(2) << std::setw(12) << r.nsPerItem << " ns/item"
+                  << std::setw(14) << formatRate(r.itemsPerSecond);
+    }
+    if (r.bytesPerSecond > 0.0)
+    {
+        std::cout << std::setprecision(1) << std::setw(10) << r.bytesPerSecond / (1024.0 * 1024.0) << " MB/s";
+    }
+    if (!r.label.empty())
+    {
+        std::cout << "  " << r.label;
+    }
+    std::cout << "\n";
+    if (!r.error.empty())
+    {
+        std::cout << "  FAILED: " << r.error << "\n";
+    }
+}
+
+static bool writeCsv(const std::string& path, const std::vector<BenchResult>& results)
+{
+    std::ofstream out(path.c_str());
+    if (!out)
+    {
+        return false;
+    }
+    out << "name,iterations,ns_per_iteration,ns_per_item,items_per_second\n";
+    out << std::setprecision(10);
+    for (const auto& r : results)
+    {
+        out << r.name << "," << r.iterations << "," << r.nsPerIteration << ","
+            << r.nsPerItem << "," << r.itemsPerSecond << "\n";
+    }
+    return static_cast<bool>(out);
+}
+
+// name -> ns per iteration from a CSV written by --csv
+static bool readBaseline(const std::string& path, std::map<std::string, double>& baseline)
+{
+    std::ifstream in(path.c_str());
+    if (!in)
+    {
+        return false;
+    }
+    std::string line;
+    std::getline(in, line); // header
+    while (std::getline(in, line))
+    {
+        std::istringstream fields(line);
+        std::string name, iterations, nsPerIteration;
+        if (std::getline(fields, name, ',') && std::getline(fields, iterations, ',')
+            && std::getline(fields, nsPerIteration, ','))
+        {
+            baseline[name] = std::strtod(nsPerIteration.c_str(), nullptr);
+        }
+    }
+    return true;
+}
+
+int runBenchmarks(int argc, char** argv)
+{
+    std::string filter, csvPath, baselinePath;
+    double minTime = 0.5;
+    double tolerance = 10.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (arg == "--filter" && hasValue) filter = argv[++i];
+        else if (arg == "--min-time" && hasValue) minTime = std::strtod(argv[++i], nullptr);
+        else if (arg == "--csv" && hasValue) csvPath = argv[++i];
+        else if (arg == "--baseline" && hasValue) baselinePath = argv[++i];
+        else if (arg == "--tolerance" && hasValue) tolerance = std::strtod(argv[++i], nullptr);
+        else
+        {
+            std::cout << "Usage: uav_bench [--filter TEXT] [--min-time S] [--csv FILE]"
+                         " [--baseline FILE] [--tolerance PCT]\n";
+            return 1;
+        }
+    }
+
+    std::map<std::string, double> baseline;
+    if (!baselinePath.empty() && !readBaseline(baselinePath, baseline))
+    {
+        std::cerr << "Could not read baseline " << baselinePath << "\n";
+        return 1;
+    }
+
+    std::cout << std::left << std::setw(36) << "Benchmark" << std::right << std::setw(17) << "Time"
+              << std::setw(12) << "Iterations" << std::setw(20) << "Per item" << std::setw(14) << "Items"
+              << "\n" << std::string(99, '-') << "\n";
+
+    std::vector<BenchResult> results;
+    int regressions = 0;
+    int failures = 0;
+    for (const auto& bench : registry())
+    {
+        std::vector<long long> args = bench.args;
+        if (args.empty())
+        {
+            args.push_back(0);
+        }
+        for (long long arg : args)
+        {
+            std::string name = bench.name;
+            if (!bench.args.empty())
+            {
+                name += "/" + std::to_string(arg);
+            }
+            if (!filter.empty() && name.find(filter) == std::string::npos)
+            {
+                continue;
+            }
+
+            BenchResult result = runOne(name, bench.fn, arg, minTime);
+            printResult(result);
+            results.push_back(result);
+            failures += !result.error.empty();
+
+            auto base = baseline.find(name);
+            if (base != baseline.end() && base->second > 0.0
+                && result.nsPerIteration > base->second * (1.0 + tolerance / 100.0))
+            {
+                std::cout << "  REGRESSION: " << std::setprecision(1)
+                          << (result.nsPerIteration / base->second - 1.0) * 100.0 << "% slower than baseline\n";
+                ++regressions;
+            }
+        }
+    }
+
+    if (!csvPath.empty() && !writeCsv(csvPath, results))
+    {
+        std::cerr << "Could not write " << csvPath << "\n";
+        return 1;
+    }
+
+    if (failures > 0)
+    {
+        std::cout << failures << " benchmark(s) failed their own checks\n";
+        return 3;
+    }
+    if (regressions > 0)
+    {
+        std::cout << regressions << " benchmark(s) regressed more than " << tolerance << "%\n";
+        return 2;
+    }
+    return 0;
+}
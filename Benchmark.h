@@ -0,0 +1,100 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Minimal Google-Benchmark-style harness for uav_bench. A benchmark is a
+function taking a BenchState; the timed part is the body of
+while (state.keepRunning()), and the iteration count grows until the run takes at
+least --min-time seconds. Results can be saved as CSV and compared against a
+saved baseline to gate performance regressions. A benchmark can also check its
+own results (setError), which fails the run.
+*/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <vector>
+#include <string>
+#include <chrono>
+
+class BenchState
+{
+public:
+    BenchState(long long arg, unsigned long long iterations);
+
+    // true while iterations remain, the clock runs from the first call to the last
+    bool keepRunning()
+    {
+        if (remaining == iterations)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        if (remaining > 0)
+        {
+            --remaining;
+            return true;
+        }
+        stop = std::chrono::steady_clock::now();
+        return false;
+    }
+
+    // argument the benchmark was registered with (0 if none)
+    long long range() const { return arg; }
+
+    unsigned long long getIterations() const { return iterations; }
+
+    // work done over the whole run, reported per second and per item
+    void setItemsProcessed(double items) { itemsProcessed = items; }
+    void setBytesProcessed(double bytes) { bytesProcessed = bytes; }
+
+    // extra text shown after the result
+    void setLabel(const std::string& text) { label = text; }
+
+    // the benchmark's own check of its results failed
+    void setError(const std::string& text) { error = text; }
+
+    double elapsedSeconds() const;
+
+    double itemsProcessed;
+    double bytesProcessed;
+    std::string label;
+    std::string error;
+
+private:
+    long long arg;
+    unsigned long long iterations;
+    unsigned long long remaining;
+    std::chrono::steady_clock::time_point start, stop;
+};
+
+typedef void (*BenchFunction)(BenchState& state);
+
+// add a benchmark, run once per argument (or once with 0 if args is empty)
+int registerBenchmark(const char* name, BenchFunction fn, const std::vector<long long>& args);
+
+// run every registered benchmark matching the command line, returns the exit code
+// options: --filter TEXT, --min-time S, --csv FILE, --baseline FILE, --tolerance PCT
+int runBenchmarks(int argc, char** argv);
+
+// keep the compiler from optimizing away a benchmark's result
+template <class T>
+inline void benchDoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const volatile void* sink;
+    sink = &value;
+#endif
+}
+
+#define BENCH_CONCAT_INNER(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_INNER(a, b)
+
+#define BENCHMARK(fn) \
+    static int BENCH_CONCAT(benchRegistered, __LINE__) = registerBenchmark(#fn, fn, std::vector<long long>())
+
+#define BENCHMARK_ARGS(fn, ...) \
+    static int BENCH_CONCAT(benchRegistered, __LINE__) = registerBenchmark(#fn, fn, std::vector<long long>{ __VA_ARGS__ })
+
+#endif
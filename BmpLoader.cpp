@@ -0,0 +1,68 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the zero-copy BMP loader
+*/
+
+#include "BmpLoader.h"
+#include <cstring>
+#include <cstdint>
+
+// little-endian field readers (BMP headers are unaligned)
+static uint32_t readU32(const char* p)
+{
+    const unsigned char* b = reinterpret_cast<const unsigned char*>(p);
+    return b[0] | (b[1] << 8) | (b[2] << 16) | (static_cast<uint32_t>(b[3]) << 24);
+}
+
+static uint16_t readU16(const char* p)
+{
+    const unsigned char* b = reinterpret_cast<const unsigned char*>(p);
+    return static_cast<uint16_t>(b[0] | (b[1] << 8));
+}
+
+bool loadBmp(const std::string& path, MappedFile& file, BmpImage& image)
+{
+    const size_t FILE_HEADER = 14;
+    const size_t MIN_INFO_HEADER = 40;
+
+    if (!file.open(path) || file.size() < FILE_HEADER + MIN_INFO_HEADER)
+    {
+        return false;
+    }
+
+    const char* data = file.data();
+    if (data[0] != 'B' || data[1] != 'M')
+    {
+        return false;
+    }
+
+    // BITMAPFILEHEADER then BITMAPINFOHEADER (or the larger V4/V5 headers,
+    // which start with the same fields)
+    uint32_t pixelOffset = readU32(data + 10);
+    const char* info = data + FILE_HEADER;
+    int32_t width = static_cast<int32_t>(readU32(info + 4));
+    int32_t height = static_cast<int32_t>(readU32(info + 8));
+    uint16_t bitsPerPixel = readU16(info + 14);
+    uint32_t compression = readU32(info + 16);
+
+    // only plain 24-bit BGR is supported (BI_RGB)
+    if (bitsPerPixel != 24 || compression != 0 || width <= 0 || height == 0)
+    {
+        return false;
+    }
+
+    image.width = width;
+    image.topDown = height < 0;
+    image.height = image.topDown ? -height : height;
+    image.rowStride = (static_cast<size_t>(width) * 3 + 3) & ~static_cast<size_t>(3);
+
+    if (pixelOffset + image.rowStride * image.height > file.size())
+    {
+        return false; // truncated
+    }
+
+    image.pixels = reinterpret_cast<const unsigned char*>(data + pixelOffset);
+    return true;
+}
@@ -0,0 +1,32 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the zero-copy BMP loader. The file stays memory mapped
+and the image just points at the pixel rows inside the mapping, which are already
+in the layout OpenGL expects for GL_BGR with 4-byte unpack alignment.
+*/
+
+#ifndef BMP_LOADER_H
+#define BMP_LOADER_H
+
+#include "MappedFile.h"
+#include <string>
+#include <cstddef>
+
+// view of a 24-bit uncompressed BMP inside its mapping
+struct BmpImage
+{
+    const unsigned char* pixels; // first stored row (bottom row unless topDown)
+    int width;
+    int height;
+    size_t rowStride;            // bytes per row including padding to 4 bytes
+    bool topDown;                // rows stored top to bottom (negative height)
+
+    BmpImage() : pixels(nullptr), width(0), height(0), rowStride(0), topDown(false) {}
+};
+
+// map path and describe its pixels, the mapping must outlive the image
+bool loadBmp(const std::string& path, MappedFile& file, BmpImage& image);
+
+#endif
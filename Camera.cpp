@@ -0,0 +1,58 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the free-moving viewer camera
+*/
+
+#include "Camera.h"
+#include <cmath>
+#include <algorithm>
+
+static const float DEG_TO_RAD = 3.14159265f / 180.0f;
+
+// constructor
+Camera::Camera()
+{
+    reset();
+}
+
+// (50, 50, 200) looking down with +y at the top of the screen, the same view
+// as the old gluLookAt(50, 50, 200, 50, 50, 0, 0, 1, 0)
+void Camera::reset()
+{
+    position = Vec3f(50.0f, 50.0f, 200.0f);
+    yaw = 90.0f;
+    pitch = -90.0f;
+}
+
+void Camera::turn(float yawDegrees, float pitchDegrees)
+{
+    yaw = std::fmod(yaw + yawDegrees, 360.0f);
+    pitch = std::max(-90.0f, std::min(90.0f, pitch + pitchDegrees));
+}
+
+void Camera::move(float forwardMetres, float rightMetres, float upMetres)
+{
+    position += forward() * forwardMetres;
+    position += right() * rightMetres;
+    position += Vec3f(0.0f, 0.0f, upMetres); // up / down stays vertical
+}
+
+Vec3f Camera::forward() const
+{
+    float y = yaw * DEG_TO_RAD, p = pitch * DEG_TO_RAD;
+    return Vec3f(std::cos(p) * std::cos(y), std::cos(p) * std::sin(y), std::sin(p));
+}
+
+Vec3f Camera::right() const
+{
+    float y = yaw * DEG_TO_RAD;
+    return Vec3f(std::sin(y), -std::cos(y), 0.0f);
+}
+
+Vec3f Camera::up() const
+{
+    float y = yaw * DEG_TO_RAD, p = pitch * DEG_TO_RAD;
+    return Vec3f(-std::sin(p) * std::cos(y), -std::sin(p) * std::sin(y), std::cos(p));
+}
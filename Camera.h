@@ -0,0 +1,37 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the free-moving viewer camera (position plus yaw and
+pitch in the Z-up world). No OpenGL here; main.cpp hands eye, forward and up to
+gluLookAt.
+*/
+
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include "VecMath.h"
+
+class Camera
+{
+public:
+    Vec3f position;
+    float yaw;   // degrees from +x toward +y
+    float pitch; // degrees above the horizon, -90 = straight down
+
+    // starts at the original fixed view: 200 m above the field center looking down
+    Camera();
+    void reset();
+
+    // look around, pitch is clamped to straight up / down
+    void turn(float yawDegrees, float pitchDegrees);
+
+    // move relative to the view direction (metres)
+    void move(float forward, float right, float up);
+
+    Vec3f forward() const;
+    Vec3f right() const;
+    Vec3f up() const; // screen up, well defined even looking straight down
+};
+
+#endif
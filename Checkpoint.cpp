@@ -0,0 +1,311 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of swarm checkpoint writing and restoring
+*/
+
+#include "Checkpoint.h"
+#include "MissionEngine.h"
+#include "SwarmBehaviours.h"
+#include <iostream>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+
+static const char CHECKPOINT_MAGIC[4] = { 'U', 'A', 'V', 'K' };
+static const uint32_t CHECKPOINT_VERSION = 3;
+
+// sections start on a cache line so the mapped arrays copy at full speed
+static const uint64_t SECTION_ALIGN = 64;
+
+// pointer and length of every section to save
+struct SectionSource
+{
+    const void* data;
+    size_t count;
+};
+
+template <typename Array>
+static SectionSource sourceOf(const Array& values)
+{
+    SectionSource source = { values.data(), values.size() };
+    return source;
+}
+
+bool writeCheckpoint(const std::string& path, const SwarmState& swarm, unsigned long long tick, bool collisions,
+                     const MissionEngine* missions, const SwarmBehaviours* behaviours)
+{
+    SectionSource sources[NUM_CHECKPOINT_SECTIONS];
+    std::memset(sources, 0, sizeof(sources));
+    for (size_t a = 0; a < SwarmState::NUM_ARRAYS; ++a)
+    {
+        sources[a] = sourceOf(swarm.array(a));
+    }
+    const uint32_t launch[2] = { missions ? missions->launchBegin : 0, missions ? missions->launchEnd : 0 };
+    if (missions && missions->size() == swarm.size())
+    {
+        sources[SECTION_MISSION_BEGIN] = sourceOf(missions->listBegin);
+        sources[SECTION_MISSION_END] = sourceOf(missions->listEnd);
+        sources[SECTION_MISSION_LAUNCH].data = launch;
+        sources[SECTION_MISSION_LAUNCH].count = 2;
+        sources[SECTION_MISSION_X] = sourceOf(missions->wpX);
+        sources[SECTION_MISSION_Y] = sourceOf(missions->wpY);
+        sources[SECTION_MISSION_Z] = sourceOf(missions->wpZ);
+        sources[SECTION_MISSION_TOLERANCE] = sourceOf(missions->wpToleranceSq);
+        sources[SECTION_MISSION_CURRENT] = sourceOf(missions->current);
+        sources[SECTION_MISSION_CURRENT_TOLERANCE] = sourceOf(missions->toleranceSq);
+        sources[SECTION_MISSION_FOLLOW_SPHERE] = sourceOf(missions->followSphere);
+        sources[SECTION_MISSION_LAPS] = sourceOf(missions->laps);
+    }
+    if (behaviours && behaviours->leader.size() == swarm.size())
+    {
+        sources[SECTION_FORMATION_LEADER] = sourceOf(behaviours->leader);
+        sources[SECTION_FORMATION_X] = sourceOf(behaviours->slotX);
+        sources[SECTION_FORMATION_Y] = sourceOf(behaviours->slotY);
+        sources[SECTION_FORMATION_Z] = sourceOf(behaviours->slotZ);
+    }
+
+    CheckpointHeader header;
+    std::memset(static_cast<void*>(&header), 0, sizeof(header));
+    std::memcpy(header.magic, CHECKPOINT_MAGIC, 4);
+    header.version = CHECKPOINT_VERSION;
+    header.uavCount = static_cast<uint32_t>(swarm.size());
+    header.flags = ((missions && missions->isLooping()) ? CHECKPOINT_MISSIONS_LOOP : 0)
+                   | (collisions ? CHECKPOINT_COLLISIONS : 0);
+    header.tick = tick;
+    header.paramsBytes = sizeof(SwarmParams) + sizeof(FlockParams);
+    header.params = swarm.params;
+    header.flock = behaviours ? behaviours->params : FlockParams();
+
+    // lay the sections out back to back after the header
+    uint64_t offset = sizeof(header);
+    for (size_t s = 0; s < NUM_CHECKPOINT_SECTIONS; ++s)
+    {
+        offset = (offset + SECTION_ALIGN - 1) & ~(SECTION_ALIGN - 1);
+        header.sections[s].offset = offset;
+        header.sections[s].count = sources[s].count;
+        offset += sources[s].count * sizeof(float);
+    }
+    header.fileBytes = offset;
+
+    // assemble the image first so the file gets one contiguous write
+    std::vector<char> image(static_cast<size_t>(header.fileBytes), 0);
+    std::memcpy(image.data(), &header, sizeof(header));
+    for (size_t s = 0; s < NUM_CHECKPOINT_SECTIONS; ++s)
+    {
+        if (sources[s].count > 0)
+        {
+            std::memcpy(image.data() + header.sections[s].offset, sources[s].data, sources[s].count * sizeof(float));
+        }
+    }
+
+    const std::string partial = path + ".partial";
+    FILE* out = std::fopen(partial.c_str(), "wb");
+    if (!out)
+    {
+        std::cerr << "Could not create checkpoint " << partial << "\n";
+        return false;
+    }
+    bool ok = std::fwrite(image.data(), image.size(), 1, out) == 1;
+    ok = (std::fclose(out) == 0) && ok;
+#ifdef _WIN32
+    // rename does not replace an existing file on Windows
+    if (ok)
+    {
+        std::remove(path.c_str());
+    }
+#endif
+    ok = ok && std::rename(partial.c_str(), path.c_str()) == 0;
+    if (!ok)
+    {
+        std::cerr << "Could not write checkpoint " << path << "\n";
+        std::remove(partial.c_str());
+    }
+    return ok;
+}
+
+// ---- CheckpointReader ----
+
+CheckpointReader::CheckpointReader()
+{
+    std::memset(static_cast<void*>(&header), 0, sizeof(header));
+}
+
+bool CheckpointReader::open(const std::string& path)
+{
+    close();
+    if (!file.open(path) || file.size() < sizeof(CheckpointHeader))
+    {
+        file.close();
+        return false;
+    }
+
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, CHECKPOINT_MAGIC, 4) != 0 || header.version != CHECKPOINT_VERSION
+        || header.paramsBytes != sizeof(SwarmParams) + sizeof(FlockParams) || header.fileBytes != file.size())
+    {
+        file.close();
+        return false;
+    }
+
+    // every section inside the file, the swarm arrays one element per UAV
+    bool ok = true;
+    for (size_t s = 0; s < NUM_CHECKPOINT_SECTIONS && ok; ++s)
+    {
+        const CheckpointSection& section = header.sections[s];
+        ok = section.offset % SECTION_ALIGN == 0 && section.offset <= header.fileBytes
+             && section.count <= (header.fileBytes - section.offset) / sizeof(float);
+        if (s < SwarmState::NUM_ARRAYS)
+        {
+            ok = ok && section.count == header.uavCount;
+        }
+    }
+    if (ok && hasMissions())
+    {
+        const uint64_t waypoints = header.sections[SECTION_MISSION_X].count;
+        ok = header.sections[SECTION_MISSION_LAUNCH].count == 2
+             && header.sections[SECTION_MISSION_Y].count == waypoints
+             && header.sections[SECTION_MISSION_Z].count == waypoints
+             && header.sections[SECTION_MISSION_TOLERANCE].count == waypoints;
+        for (size_t s = SECTION_MISSION_CURRENT; s <= SECTION_MISSION_LAPS; ++s)
+        {
+            ok = ok && header.sections[s].count == header.uavCount;
+        }
+        ok = ok && header.sections[SECTION_MISSION_BEGIN].count == header.uavCount
+             && header.sections[SECTION_MISSION_END].count == header.uavCount;
+    }
+    if (ok && hasFormation())
+    {
+        for (size_t s = SECTION_FORMATION_LEADER; s <= SECTION_FORMATION_Z; ++s)
+        {
+            ok = ok && header.sections[s].count == header.uavCount;
+        }
+    }
+    if (!ok || !indicesValid())
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+const uint32_t* CheckpointReader::indices(size_t id) const
+{
+    return reinterpret_cast<const uint32_t*>(file.data() + header.sections[id].offset);
+}
+
+const float* CheckpointReader::values(size_t id) const
+{
+    return reinterpret_cast<const float*>(file.data() + header.sections[id].offset);
+}
+
+// one pass over the index sections (section sizes are already checked)
+bool CheckpointReader::indicesValid() const
+{
+    const size_t count = header.uavCount;
+    if (hasMissions())
+    {
+        // lists inside the waypoint storage; a UAV with waypoints flies one of
+        // its own, one without never reaches a waypoint
+        const uint64_t waypoints = header.sections[SECTION_MISSION_X].count;
+        const uint32_t* first = indices(SECTION_MISSION_BEGIN);
+        const uint32_t* last = indices(SECTION_MISSION_END);
+        const uint32_t* launch = indices(SECTION_MISSION_LAUNCH);
+        const uint32_t* current = indices(SECTION_MISSION_CURRENT);
+        const float* toleranceSq = values(SECTION_MISSION_CURRENT_TOLERANCE);
+        if (launch[0] > launch[1] || launch[1] > waypoints)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (first[i] > last[i] || last[i] > waypoints)
+            {
+                return false;
+            }
+            const bool empty = first[i] == last[i];
+            if (empty ? (current[i] != first[i] || !(toleranceSq[i] < 0.0f))
+                      : (current[i] < first[i] || current[i] >= last[i]))
+            {
+                return false;
+            }
+        }
+    }
+    if (hasFormation())
+    {
+        const uint32_t* leader = indices(SECTION_FORMATION_LEADER);
+        for (size_t i = 0; i < count; ++i)
+        {
+            // leaders lead themselves, so groups are one level deep
+            if (leader[i] >= count || leader[leader[i]] != leader[i])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void CheckpointReader::close()
+{
+    file.close();
+    std::memset(static_cast<void*>(&header), 0, sizeof(header));
+}
+
+template <typename Array>
+void CheckpointReader::copySection(size_t id, Array& out) const
+{
+    typedef typename Array::value_type Element;
+    const CheckpointSection& section = header.sections[id];
+    const Element* first = reinterpret_cast<const Element*>(file.data() + section.offset);
+    out.assign(first, first + section.count);
+}
+
+void CheckpointReader::restore(SwarmState& swarm) const
+{
+    swarm.params = header.params;
+    for (size_t a = 0; a < SwarmState::NUM_ARRAYS; ++a)
+    {
+        copySection(a, swarm.array(a));
+    }
+}
+
+bool CheckpointReader::restore(MissionEngine& missions) const
+{
+    if (!hasMissions())
+    {
+        return false;
+    }
+    std::vector<uint32_t> launch;
+    copySection(SECTION_MISSION_LAUNCH, launch);
+    missions.launchBegin = launch[0];
+    missions.launchEnd = launch[1];
+    copySection(SECTION_MISSION_BEGIN, missions.listBegin);
+    copySection(SECTION_MISSION_END, missions.listEnd);
+    copySection(SECTION_MISSION_X, missions.wpX);
+    copySection(SECTION_MISSION_Y, missions.wpY);
+    copySection(SECTION_MISSION_Z, missions.wpZ);
+    copySection(SECTION_MISSION_TOLERANCE, missions.wpToleranceSq);
+    copySection(SECTION_MISSION_CURRENT, missions.current);
+    copySection(SECTION_MISSION_CURRENT_TOLERANCE, missions.toleranceSq);
+    copySection(SECTION_MISSION_FOLLOW_SPHERE, missions.followSphere);
+    copySection(SECTION_MISSION_LAPS, missions.laps);
+    missions.setLooping((header.flags & CHECKPOINT_MISSIONS_LOOP) != 0);
+    return true;
+}
+
+void CheckpointReader::restore(SwarmBehaviours& behaviours) const
+{
+    behaviours.params = header.flock;
+    if (!hasFormation())
+    {
+        behaviours.clearFormation();
+        return;
+    }
+    copySection(SECTION_FORMATION_LEADER, behaviours.leader);
+    copySection(SECTION_FORMATION_X, behaviours.slotX);
+    copySection(SECTION_FORMATION_Y, behaviours.slotY);
+    copySection(SECTION_FORMATION_Z, behaviours.slotZ);
+    behaviours.linkFormation();
+}
@@ -0,0 +1,126 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for swarm checkpoints. A checkpoint holds everything a
+run needs to carry on where it stopped: the tick, the SwarmParams, the flocking
+weights and collision setting, every SwarmState array (kinematics, PID integral
+and last error, targets), mission progress and formation slots. The file is one CheckpointHeader followed by raw
+arrays at 64-byte aligned offsets listed in the header's section table, written
+with a single write and restored from a memory-mapped file by bulk copies with
+no per-field parsing. Sections that were not saved (no missions, no formation)
+have a count of 0. Opening a checkpoint checks every index stored in it (mission
+lists, current waypoints, formation leaders), so a damaged file is refused
+rather than read out of bounds.
+*/
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "SwarmState.h"
+#include "SwarmBehaviours.h"
+#include "MappedFile.h"
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+class MissionEngine;
+
+// section table order: the SwarmState arrays (SwarmState::array order), then
+// mission and formation state
+enum CheckpointSectionId
+{
+    SECTION_MISSION_BEGIN = SwarmState::NUM_ARRAYS,
+    SECTION_MISSION_END,
+    SECTION_MISSION_LAUNCH, // launchBegin, launchEnd
+    SECTION_MISSION_X,
+    SECTION_MISSION_Y,
+    SECTION_MISSION_Z,
+    SECTION_MISSION_TOLERANCE,
+    SECTION_MISSION_CURRENT,
+    SECTION_MISSION_CURRENT_TOLERANCE,
+    SECTION_MISSION_FOLLOW_SPHERE,
+    SECTION_MISSION_LAPS,
+    SECTION_FORMATION_LEADER,
+    SECTION_FORMATION_X,
+    SECTION_FORMATION_Y,
+    SECTION_FORMATION_Z,
+    NUM_CHECKPOINT_SECTIONS
+};
+
+static const uint32_t CHECKPOINT_MISSIONS_LOOP = 1;
+static const uint32_t CHECKPOINT_COLLISIONS = 2;
+
+// one array of 4-byte elements (float or uint32_t)
+struct CheckpointSection
+{
+    uint64_t offset; // from the start of the file
+    uint64_t count;  // elements, 0 = not saved
+};
+
+struct CheckpointHeader
+{
+    char magic[4];          // "UAVK"
+    uint32_t version;
+    uint32_t uavCount;
+    uint32_t flags;         // CHECKPOINT_MISSIONS_LOOP, CHECKPOINT_COLLISIONS
+    uint64_t tick;          // scheduler ticks done when the checkpoint was taken
+    uint64_t fileBytes;     // whole file, a shorter file was cut off
+    uint32_t paramsBytes;   // sizeof(SwarmParams) + sizeof(FlockParams) of the writer
+    uint32_t reserved;
+    SwarmParams params;
+    FlockParams flock;      // all weights zero if the run was not flocking
+    CheckpointSection sections[NUM_CHECKPOINT_SECTIONS];
+};
+
+// write the swarm at tick and whether collisions are on, plus mission progress
+// and the flocking weights and formation slots when given (nullptr = not
+// saved); the file is written next to path and renamed over it, so an
+// interrupted write never leaves a torn checkpoint behind
+bool writeCheckpoint(const std::string& path, const SwarmState& swarm, unsigned long long tick, bool collisions,
+                     const MissionEngine* missions = nullptr, const SwarmBehaviours* behaviours = nullptr);
+
+class CheckpointReader
+{
+public:
+    CheckpointReader();
+
+    // map a checkpoint, returns false if it is missing, truncated, damaged (an
+    // index out of range) or not a checkpoint of this version
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return file.isOpen(); }
+    const CheckpointHeader& getHeader() const { return header; }
+    unsigned long long getTick() const { return header.tick; }
+    size_t uavCount() const { return header.uavCount; }
+    bool hasMissions() const { return header.sections[SECTION_MISSION_CURRENT].count > 0; }
+    bool hasFormation() const { return header.sections[SECTION_FORMATION_LEADER].count > 0; }
+    bool collisionsEnabled() const { return (header.flags & CHECKPOINT_COLLISIONS) != 0; }
+
+    // replace the swarm (params and every array) with the checkpoint's
+    void restore(SwarmState& swarm) const;
+
+    // put back mission lists and progress, returns false if the checkpoint
+    // has none
+    bool restore(MissionEngine& missions) const;
+
+    // put back the flocking weights and, if saved, the formation slots
+    void restore(SwarmBehaviours& behaviours) const;
+
+private:
+    template <typename Array>
+    void copySection(size_t id, Array& out) const;
+
+    // a section's elements, read straight from the mapping
+    const uint32_t* indices(size_t id) const;
+    const float* values(size_t id) const;
+
+    // every stored index in range
+    bool indicesValid() const;
+
+    MappedFile file;
+    CheckpointHeader header;
+};
+
+#endif
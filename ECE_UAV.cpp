@@ -1,25 +1,21 @@
 /*
 Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
 Class: ECE 4122
-Last Date Modified: 11/28/2025
+Last Date Modified: 10/16/2026
 Description: Implementation of ECE_UAV class member functions for UAV simulation.
 */
 
 #include "ECE_UAV.h"
+#include "SpatialHash.h"
 #include <iostream>
 #include <cmath>
+#include <algorithm>
 
 
-// constructor
+// constructor, initial accelerations and velocities = 0
 ECE_UAV::ECE_UAV(float x, float y, float z)
+    : pos(x, y, z), vel(0.0f, 0.0f, 0.0f), acc(0.0f, 0.0f, 0.0f)
 {
-    posX = x;
-    posY = y;
-    posZ = z;
-
-    // initial accelerations and velocities = 0
-    velX = velY = velZ = 0.0f;
-    accX = accY = accZ = 0.0f;
 
     mass = 1.0;
     maxForcePerAxis = 20.0;
@@ -35,98 +31,76 @@ ECE_UAV::ECE_UAV(float x, float y, float z)
     pidVz = PIDController(4.0, 0.2, 0.8);
 }
 
-// Apply PID control
-void ECE_UAV::applyPIDControl()
+// closest point on the sphere the swarm orbits (default target)
+Vec3f ECE_UAV::sphereTarget() const
 {
-    const float dt = 0.01f; // time step
-
     // sphere center
-    const float cx = 0.0f;
-    const float cy = 0.0f;
-    const float cz = 50.0f;
+    const Vec3f center(0.0f, 0.0f, 50.0f);
 
     // vector from center to UAV
-    float dx = posX - cx;
-    float dy = posY - cy;
-    float dz = posZ - cz;
+    Vec3f offset = pos - center;
 
     const float desiredRad = 10.0f;
-    float currRad = std::sqrt(dx * dx + dy * dy + dz * dz);
+    float currRad = offset.magnitude();
 
-    // edge case: at center
+    // edge case: at center, no closest point so head for the top
     if (currRad < 0.01f)
     {
-        accX = 0.0f;
-        accY = 0.0f;
-        accZ = 2.0f; // small acceleration upwards
-        return;
+        return Vec3f(center.x, center.y, center.z + desiredRad);
     }
 
-    // unit direction center to UAV
-    float ux = dx / currRad;
-    float uy = dy / currRad;
-    float uz = dz / currRad;
+    // center + unit direction * radius
+    Vec3f desired = center;
+    desired.addScaled(offset, desiredRad / currRad);
+    return desired;
+}
 
-    float desX = cx + ux * desiredRad;
-    float desY = cy + uy * desiredRad;
-    float desZ = cz + uz * desiredRad;
+// Apply PID control toward the sphere
+void ECE_UAV::applyPIDControl()
+{
+    applyPIDControl(sphereTarget());
+}
+
+// Apply PID control toward a target position
+void ECE_UAV::applyPIDControl(const Vec3f& target)
+{
+    const float dt = 0.01f; // time step
 
     // position errors
-    float errorX = desX - posX;
-    float errorY = desY - posY;
-    float errorZ = desZ - posZ;
+    Vec3f error = target - pos;
 
     // PID on position
-    float forceX = static_cast<float>(pidX.calculate(errorX, dt));
-    float forceY = static_cast<float>(pidY.calculate(errorY, dt));
-    float forceZ = static_cast<float>(pidZ.calculate(errorZ, dt));
-
-    // drag force (F = -kv)
-    float dragX = -static_cast<float>(dragCoeff) * velX;
-    float dragY = -static_cast<float>(dragCoeff) * velY;    
-    float dragZ = -static_cast<float>(dragCoeff) * velZ;
-
+    Vec3f force(static_cast<float>(pidX.calculate(error.x, dt)),
+                static_cast<float>(pidY.calculate(error.y, dt)),
+                static_cast<float>(pidZ.calculate(error.z, dt)));
 
-    // total forces exluding gravity 
-    forceX += dragX;
-    forceY += dragY;
-    forceZ += dragZ;
+    // drag force (F = -kv), total forces exluding gravity
+    force.addScaled(vel, -static_cast<float>(dragCoeff));
 
     // clamp to maxforce
-    if (forceX > maxForcePerAxis) forceX = static_cast<float>(maxForcePerAxis);
-    if (forceX < -maxForcePerAxis) forceX = static_cast<float>(-maxForcePerAxis);
-
-    if (forceY > maxForcePerAxis) forceY = static_cast<float>(maxForcePerAxis);
-    if (forceY < -maxForcePerAxis) forceY = static_cast<float>(-maxForcePerAxis);
-
-    if (forceZ > maxForcePerAxis) forceZ = static_cast<float>(maxForcePerAxis);
-    if (forceZ < -maxForcePerAxis) forceZ = static_cast<float>(-maxForcePerAxis);
+    force.clamp(static_cast<float>(-maxForcePerAxis), static_cast<float>(maxForcePerAxis));
 
     // acceleration = F/m
-    accX = forceX / static_cast<float>(mass);
-    accY = forceY / static_cast<float>(mass);
-    accZ = forceZ / static_cast<float>(mass);
+    acc = force / static_cast<float>(mass);
 }
 
 // check collision with another UAV and swap velocities (because elastic collision)
 void ECE_UAV::checkCollision(ECE_UAV& otherUAV)
 {
-    float dx = posX - otherUAV.posX;
-    float dy = posY - otherUAV.posY;
-    float dz = posZ - otherUAV.posZ;
-
-    float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
-
-    if (distance < 0.01f) // < 1cm = collision
+    // compare squared distances, no sqrt needed
+    if (pos.distanceSquared(otherUAV.pos) < UAV_COLLISION_DISTANCE * UAV_COLLISION_DISTANCE)
     {
-        // Swap velocities
-        std::swap(velX, otherUAV.velX);
-        std::swap(velY, otherUAV.velY);
-        std::swap(velZ, otherUAV.velZ);
+        swapVelocities(otherUAV);
     }
 }
 
-// motion update loop (update every 10 ms)
+// elastic collision response between equal masses
+void ECE_UAV::swapVelocities(ECE_UAV& otherUAV)
+{
+    std::swap(vel, otherUAV.vel);
+}
+
+// advance one 10 ms physics tick (paced by SwarmScheduler)
 void ECE_UAV::controlLoop()
 {
     const float dt = 0.01f; // time step
@@ -134,52 +108,74 @@ void ECE_UAV::controlLoop()
 
     const float gravity = -10.0f; // gravity given from pdf
 
-    // lock while updating shared UAV data
-    uavMutex.lock();
-
-    // velocity update
-    velX += accX * dt;
-    velY += accY * dt;
-    velZ += (accZ + gravity) * dt;
-
-    // position update
-    posX += velX * dt + 0.5f * accX * dt * dt;
-    posY += velY * dt + 0.5f * accY * dt * dt;
-    posZ += velZ * dt + 0.5f * accZ * dt * dt;
+    // no lock needed: only the scheduler touches live UAV state, the
+    // renderer reads the published SwarmSnapshotBuffer instead
+    // semi-implicit Euler: velocity first (gravity included), then position
+    // from the new velocity
+    vel.addScaled(acc, dt);
+    vel.z += gravity * dt;
+    pos.addScaled(vel, dt);
 
     // dont want to go below z = 0
-    if (posZ < 0.0f)
+    if (pos.z < 0.0f)
     {
-        posZ = 0.0f;
-        if (velZ < 0.0f)
+        pos.z = 0.0f;
+        if (vel.z < 0.0f)
         {
-            velZ = 0.0f; // stop downward velocity
+            vel.z = 0.0f; // stop downward velocity
         }
     }
-
-    uavMutex.unlock();
-
-    std::this_thread::sleep_for(std::chrono::milliseconds(10)); // run every 10 ms
-    
 }
 
-//handle collisions between all UAVs
+//handle collisions between all UAVs, spatial hash broad phase so only UAVs
+//in neighbouring cells are compared
 void handleCollisions(std::vector<ECE_UAV>& uavs)
 {
+    std::vector<float> xs(uavs.size()), ys(uavs.size()), zs(uavs.size());
     for (size_t i = 0; i < uavs.size(); ++i)
     {
-        for (size_t j = i + 1; j < uavs.size(); ++j)
-        {
-            uavs[i].checkCollision(uavs[j]);
-        }
+        xs[i] = uavs[i].pos.x;
+        ys[i] = uavs[i].pos.y;
+        zs[i] = uavs[i].pos.z;
+    }
+
+    SpatialHash grid(UAV_COLLISION_DISTANCE * 4.0f);
+    grid.build(xs.data(), ys.data(), zs.data(), uavs.size());
+
+    std::vector<ContactPair> pairs;
+    grid.findPairs(0, grid.bucketCount(), UAV_COLLISION_DISTANCE, pairs);
+
+    // same (i, j) order as the old all-pairs loop
+    std::sort(pairs.begin(), pairs.end(), [](const ContactPair& a, const ContactPair& b)
+    {
+        return a.first != b.first ? a.first < b.first : a.second < b.second;
+    });
+
+    for (const auto& pair : pairs)
+    {
+        uavs[pair.first].swapVelocities(uavs[pair.second]);
     }
 }
 
-// thread function for UAV control loop
-void threadFunction(ECE_UAV* uav)
+// grid formation covering x in [0, 50], y in [0, 100], filled column by column
+void fieldFormationPosition(size_t index, size_t count, float& x, float& y)
 {
-    while (true)
+    size_t cols = static_cast<size_t>(std::ceil(std::sqrt(count / 2.0)));
+    size_t rows = (count + cols - 1) / cols;
+    float spacingX = (cols > 1) ? 50.0f / (cols - 1) : 0.0f;
+    float spacingY = (rows > 1) ? 100.0f / (rows - 1) : 0.0f;
+
+    x = (index / rows) * spacingX;
+    y = (index % rows) * spacingY;
+}
+
+void initFieldFormation(std::vector<ECE_UAV>& uavs, size_t count)
+{
+    uavs.reserve(uavs.size() + count);
+    for (size_t i = 0; i < count; ++i)
     {
-        uav->controlLoop();
+        float x, y;
+        fieldFormationPosition(i, count, x, y);
+        uavs.emplace_back(x, y, 0.0f);
     }
-}
\ No newline at end of file
+}
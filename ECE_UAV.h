@@ -1,19 +1,19 @@
 /*
 Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
 Class: ECE 4122
-Last Date Modified: 11/28/2025
+Last Date Modified: 10/16/2026
 Description: Interface for ECE_UAV class representing UAVs in simulation
 */
 
 #ifndef ECE_UAV_H
 #define ECE_UAV_H
 
-#include <thread>
-#include <chrono>
+#include "VecMath.h"
 #include <vector>
-#include <mutex>
+#include <cstddef>
 
-extern std::mutex uavMutex;
+// UAVs closer than this (1 cm) have collided
+const float UAV_COLLISION_DISTANCE = 0.01f;
 
 class PIDController
 {
@@ -47,9 +47,9 @@ class ECE_UAV
 public:
     
     // UAV variables
-    float posX, posY, posZ;
-    float velX, velY, velZ;
-    float accX, accY, accZ;
+    Vec3f pos;
+    Vec3f vel;
+    Vec3f acc;
 
     double mass;
     double maxForcePerAxis;
@@ -63,12 +63,21 @@ public:
     ECE_UAV(float x, float y, float z);
 
     // methods
+    Vec3f sphereTarget() const;
     void applyPIDControl();
+    void applyPIDControl(const Vec3f& target);
     void checkCollision(ECE_UAV& otherUAV);
+    void swapVelocities(ECE_UAV& otherUAV);
     void controlLoop();
 };
 
-void threadFunction(ECE_UAV* uav);
 void handleCollisions(std::vector<ECE_UAV>& uavs);
 
+// lay count UAVs out on the ground in a grid over the 50 x 100 yard field
+// (15 gives the original 3 x 5 formation)
+void initFieldFormation(std::vector<ECE_UAV>& uavs, size_t count);
+
+// ground position of UAV index in that formation
+void fieldFormationPosition(size_t index, size_t count, float& x, float& y);
+
 #endif
\ No newline at end of file
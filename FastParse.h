@@ -0,0 +1,154 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Small hand-rolled text parsing helpers for memory-mapped input. They
+work directly on [p, end) ranges: no iostream, no locale, no allocation.
+*/
+
+#ifndef FAST_PARSE_H
+#define FAST_PARSE_H
+
+#include <climits>
+#include <cmath>
+
+// skip spaces and tabs (not newlines)
+inline void skipSpaces(const char*& p, const char* end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+    {
+        ++p;
+    }
+}
+
+// move past the end of the current line
+inline void skipLine(const char*& p, const char* end)
+{
+    while (p < end && *p != '\n')
+    {
+        ++p;
+    }
+    if (p < end)
+    {
+        ++p;
+    }
+}
+
+// parse a signed integer, returns false if no digits were found or the value
+// does not fit in a long (the digits are still consumed)
+inline bool parseInt(const char*& p, const char* end, long& out)
+{
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    const char* start = p;
+    long value = 0;
+    bool overflow = false;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+        const long digit = *p - '0';
+        if (value > (LONG_MAX - digit) / 10)
+        {
+            overflow = true;
+        }
+        else
+        {
+            value = value * 10 + digit;
+        }
+        ++p;
+    }
+    if (p == start || overflow)
+    {
+        return false;
+    }
+
+    out = negative ? -value : value;
+    return true;
+}
+
+// exponents past this are rejected rather than scaled
+static const long MAX_EXPONENT = 9999;
+
+// parse a decimal float with optional exponent (e.g. -1.25e-3), returns false
+// if no digits were found or the value is not a finite float
+inline bool parseFloat(const char*& p, const char* end, float& out)
+{
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    const char* start = p;
+    double mantissa = 0.0;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+        mantissa = mantissa * 10.0 + (*p - '0');
+        ++p;
+    }
+
+    int exponent = 0;
+    if (p < end && *p == '.')
+    {
+        ++p;
+        while (p < end && *p >= '0' && *p <= '9')
+        {
+            mantissa = mantissa * 10.0 + (*p - '0');
+            --exponent;
+            ++p;
+        }
+    }
+    if (p == start || (p == start + 1 && *start == '.'))
+    {
+        return false;
+    }
+
+    if (p < end && (*p == 'e' || *p == 'E'))
+    {
+        const char* expStart = p++;
+        const char* digits = (p < end && (*p == '-' || *p == '+')) ? p + 1 : p;
+        long e = 0;
+        if (digits >= end || *digits < '0' || *digits > '9')
+        {
+            p = expStart; // not an exponent after all
+        }
+        else if (!parseInt(p, end, e) || e > MAX_EXPONENT || e < -MAX_EXPONENT)
+        {
+            return false; // far outside float range, and would overflow the int
+        }
+        else
+        {
+            exponent += static_cast<int>(e);
+        }
+    }
+
+    // scale by 10^exponent with repeated squaring
+    double scale = 1.0;
+    double base = 10.0;
+    int n = exponent < 0 ? -exponent : exponent;
+    while (n)
+    {
+        if (n & 1)
+        {
+            scale *= base;
+        }
+        base *= base;
+        n >>= 1;
+    }
+    double value = (mantissa == 0.0) ? 0.0 : (exponent < 0 ? mantissa / scale : mantissa * scale);
+
+    const float result = static_cast<float>(negative ? -value : value);
+    if (!std::isfinite(result))
+    {
+        return false;
+    }
+    out = result;
+    return true;
+}
+
+#endif
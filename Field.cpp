@@ -0,0 +1,91 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Textured football field. ff.bmp is 512 x 256 with the goal lines at
+pixel columns 55 and 442 (3.87 px per yard); the quad is placed so the goal lines
+sit at y = 0 and y = 100 and the field is centered on x = 25, matching the UAV
+formation.
+*/
+
+#include "Field.h"
+#include "BmpLoader.h"
+#include <GL/glut.h>
+
+#ifndef GL_BGR
+#define GL_BGR 0x80E0
+#endif
+
+// image -> world mapping of ff.bmp
+static const float GOAL_LINE_PX = 55.0f;
+static const float PX_PER_YARD = 3.87f;
+static const float FIELD_CENTER_X = 25.0f;
+
+static GLuint fieldTexture = 0;
+static GLuint fieldList = 0;
+
+bool initField(const std::string& bmpPath)
+{
+    MappedFile file;
+    BmpImage image;
+    if (!loadBmp(bmpPath, file, image))
+    {
+        return false;
+    }
+
+    glGenTextures(1, &fieldTexture);
+    glBindTexture(GL_TEXTURE_2D, fieldTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+
+    // BMP rows are padded to 4 bytes and stored BGR bottom-up, which is exactly
+    // what GL unpacks with GL_BGR and 4-byte alignment: upload straight from the
+    // mapping, no staging copy
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, image.width, image.height, 0,
+                 GL_BGR, GL_UNSIGNED_BYTE, image.pixels);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // GL copied the pixels, the mapping can go
+    file.close();
+
+    // field extent in world units (yards)
+    float y0 = -GOAL_LINE_PX / PX_PER_YARD;
+    float y1 = (image.width - GOAL_LINE_PX) / PX_PER_YARD;
+    float halfWidth = 0.5f * image.height / PX_PER_YARD;
+    float x0 = FIELD_CENTER_X - halfWidth;
+    float x1 = FIELD_CENTER_X + halfWidth;
+
+    // top-down BMPs just flip t instead of flipping rows
+    float tBottom = image.topDown ? 1.0f : 0.0f;
+    float tTop = 1.0f - tBottom;
+
+    // image u runs along the field length (world y), t across it (world x)
+    fieldList = glGenLists(1);
+    glNewList(fieldList, GL_COMPILE);
+    glPushAttrib(GL_ENABLE_BIT | GL_CURRENT_BIT | GL_TEXTURE_BIT);
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, fieldTexture);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
+    glBegin(GL_QUADS);
+    glTexCoord2f(0.0f, tBottom); glVertex3f(x1, y0, 0.0f);
+    glTexCoord2f(1.0f, tBottom); glVertex3f(x1, y1, 0.0f);
+    glTexCoord2f(1.0f, tTop);    glVertex3f(x0, y1, 0.0f);
+    glTexCoord2f(0.0f, tTop);    glVertex3f(x0, y0, 0.0f);
+    glEnd();
+    glPopAttrib();
+    glEndList();
+
+    return true;
+}
+
+void drawField()
+{
+    if (fieldList)
+    {
+        glCallList(fieldList);
+    }
+}
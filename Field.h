@@ -0,0 +1,20 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the textured football field under the swarm
+*/
+
+#ifndef FIELD_H
+#define FIELD_H
+
+#include <string>
+
+// upload the field texture straight from the mapped BMP and record the quad in a
+// display list, needs a current GL context; returns false if the BMP is unusable
+bool initField(const std::string& bmpPath);
+
+// draw the field (one display list call, no per-frame CPU work)
+void drawField();
+
+#endif
@@ -0,0 +1,139 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of frustum culling and LOD selection
+*/
+
+#include "Frustum.h"
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+// UAVs tested per block before the visible ones are scattered
+static const size_t CULL_BLOCK = 256;
+
+// Gribb / Hartmann: each plane is the last row of the clip matrix plus or
+// minus one of the other rows
+void Frustum::extract(const float* projection, const float* modelview)
+{
+    // clip = projection * modelview, column-major: m[col * 4 + row]
+    float m[16];
+    for (int col = 0; col < 4; ++col)
+    {
+        for (int row = 0; row < 4; ++row)
+        {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; ++k)
+            {
+                sum += projection[k * 4 + row] * modelview[col * 4 + k];
+            }
+            m[col * 4 + row] = sum;
+        }
+    }
+
+    for (int p = 0; p < 6; ++p)
+    {
+        const int row = p / 2;                   // x, y, z
+        const float sign = (p % 2) ? -1.0f : 1.0f; // left/bottom/near, then right/top/far
+        float length = 0.0f;
+        for (int c = 0; c < 4; ++c)
+        {
+            planes[p][c] = m[c * 4 + 3] + sign * m[c * 4 + row];
+            if (c < 3)
+            {
+                length += planes[p][c] * planes[p][c];
+            }
+        }
+        length = std::sqrt(length);
+        for (int c = 0; c < 4; ++c)
+        {
+            planes[p][c] /= length;
+        }
+    }
+}
+
+bool Frustum::sphereVisible(float x, float y, float z, float radius) const
+{
+    for (int p = 0; p < 6; ++p)
+    {
+        if (planes[p][0] * x + planes[p][1] * y + planes[p][2] * z + planes[p][3] < -radius)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+float screenSizeDistance(float radius, float fovYDegrees, int viewportHeight, float pixels)
+{
+    float halfFov = fovYDegrees * 0.5f * 3.14159265f / 180.0f;
+    return radius * viewportHeight / (pixels * std::tan(halfFov));
+}
+
+size_t cullSwarm(const float* posX, const float* posY, const float* posZ, size_t count,
+                 const Frustum& frustum, float radius, const Vec3f& eye,
+                 const std::vector<float>& lodDistances, std::vector<LodBatch>& levels)
+{
+    levels.resize(lodDistances.size() + 1);
+    for (auto& level : levels)
+    {
+        level.x.clear();
+        level.y.clear();
+        level.z.clear();
+    }
+
+    std::vector<float> lodDistSq(lodDistances.size());
+    for (size_t l = 0; l < lodDistances.size(); ++l)
+    {
+        lodDistSq[l] = lodDistances[l] * lodDistances[l];
+    }
+
+    const float (*pl)[4] = frustum.planes;
+    uint8_t inside[CULL_BLOCK];
+    size_t visible = 0;
+
+    for (size_t begin = 0; begin < count; begin += CULL_BLOCK)
+    {
+        const size_t n = std::min(CULL_BLOCK, count - begin);
+        const float* x = posX + begin;
+        const float* y = posY + begin;
+        const float* z = posZ + begin;
+
+        // branch-free plane tests, one plane at a time over the block so the
+        // compiler can vectorise the loop
+        for (size_t i = 0; i < n; ++i)
+        {
+            inside[i] = 1;
+        }
+        for (int p = 0; p < 6; ++p)
+        {
+            const float a = pl[p][0], b = pl[p][1], c = pl[p][2], d = pl[p][3] + radius;
+            for (size_t i = 0; i < n; ++i)
+            {
+                inside[i] &= static_cast<uint8_t>(a * x[i] + b * y[i] + c * z[i] + d >= 0.0f);
+            }
+        }
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (!inside[i])
+            {
+                continue;
+            }
+            float dx = x[i] - eye.x, dy = y[i] - eye.y, dz = z[i] - eye.z;
+            float distSq = dx * dx + dy * dy + dz * dz;
+            size_t level = 0;
+            while (level < lodDistSq.size() && distSq >= lodDistSq[level])
+            {
+                ++level;
+            }
+            LodBatch& batch = levels[level];
+            batch.x.push_back(x[i]);
+            batch.y.push_back(y[i]);
+            batch.z.push_back(z[i]);
+            ++visible;
+        }
+    }
+    return visible;
+}
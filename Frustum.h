@@ -0,0 +1,48 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for view-frustum culling and level-of-detail selection of
+the swarm. The six frustum planes are taken from the combined projection and
+modelview matrix; cullSwarm tests every UAV's bounding sphere against them in
+blocks over the SoA position arrays and sorts the visible ones into per-LOD
+position arrays, ready to upload as instance buffers.
+*/
+
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include "VecMath.h"
+#include <vector>
+#include <cstddef>
+
+struct Frustum
+{
+    // a x + b y + c z + d >= 0 inside, (a, b, c) unit length
+    float planes[6][4];
+
+    // from column-major OpenGL matrices (glGetFloatv order)
+    void extract(const float* projection, const float* modelview);
+
+    bool sphereVisible(float x, float y, float z, float radius) const;
+};
+
+// visible UAV positions of one LOD level, [x...][y...][z...] like SwarmFrame
+struct LodBatch
+{
+    std::vector<float> x, y, z;
+    size_t size() const { return x.size(); }
+};
+
+// distance at which a sphere of this radius covers the given height in pixels
+float screenSizeDistance(float radius, float fovYDegrees, int viewportHeight, float pixels);
+
+// visible UAVs (bounding sphere of radius) sorted into levels.size() batches:
+// a UAV closer to eye than lodDistances[0] is level 0, closer than
+// lodDistances[1] level 1 and so on, anything farther the last level
+// (levels.size() == lodDistances.size() + 1). Returns the visible count
+size_t cullSwarm(const float* posX, const float* posY, const float* posZ, size_t count,
+                 const Frustum& frustum, float radius, const Vec3f& eye,
+                 const std::vector<float>& lodDistances, std::vector<LodBatch>& levels);
+
+#endif
@@ -0,0 +1,214 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of mesh generation helpers
+*/
+
+#include "Mesh.h"
+#include <cmath>
+#include <unordered_map>
+#include <algorithm>
+
+Mesh makeSphereMesh(float radius, int slices, int stacks)
+{
+    const float pi = 3.14159265358979f;
+    Mesh mesh;
+
+    // (stacks + 1) rings of (slices + 1) vertices, seam duplicated
+    mesh.vertices.reserve((stacks + 1) * (slices + 1) * Mesh::FLOATS_PER_VERTEX);
+    for (int st = 0; st <= stacks; ++st)
+    {
+        float phi = pi * st / stacks; // 0 at +z pole
+        float z = std::cos(phi);
+        float r = std::sin(phi);
+
+        for (int sl = 0; sl <= slices; ++sl)
+        {
+            float theta = 2.0f * pi * sl / slices;
+            float nx = r * std::cos(theta);
+            float ny = r * std::sin(theta);
+
+            mesh.vertices.push_back(nx * radius);
+            mesh.vertices.push_back(ny * radius);
+            mesh.vertices.push_back(z * radius);
+            mesh.vertices.push_back(nx);
+            mesh.vertices.push_back(ny);
+            mesh.vertices.push_back(z);
+        }
+    }
+
+    // two triangles per quad, counter-clockwise seen from outside
+    mesh.indices.reserve(stacks * slices * 6);
+    for (int st = 0; st < stacks; ++st)
+    {
+        for (int sl = 0; sl < slices; ++sl)
+        {
+            uint32_t a = st * (slices + 1) + sl;
+            uint32_t b = a + slices + 1;
+
+            mesh.indices.push_back(a);
+            mesh.indices.push_back(b);
+            mesh.indices.push_back(a + 1);
+
+            mesh.indices.push_back(a + 1);
+            mesh.indices.push_back(b);
+            mesh.indices.push_back(b + 1);
+        }
+    }
+
+    return mesh;
+}
+
+Mesh simplifyMesh(const Mesh& mesh, int resolution)
+{
+    const size_t n = mesh.vertexCount();
+    const size_t stride = Mesh::FLOATS_PER_VERTEX;
+    Mesh out;
+    if (n == 0 || resolution < 1)
+    {
+        return out;
+    }
+
+    const float* v = mesh.vertices.data();
+    float lo[3] = { v[0], v[1], v[2] };
+    float hi[3] = { v[0], v[1], v[2] };
+    for (size_t i = 1; i < n; ++i)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            float c = v[i * stride + k];
+            if (c < lo[k]) lo[k] = c;
+            if (c > hi[k]) hi[k] = c;
+        }
+    }
+    float extent = std::max(hi[0] - lo[0], std::max(hi[1] - lo[1], hi[2] - lo[2]));
+    float invCell = (extent > 0.0f) ? resolution / extent : 0.0f;
+
+    // cell key -> output vertex, summing positions and normals
+    std::unordered_map<uint64_t, uint32_t> cells;
+    std::vector<uint32_t> remap(n);
+    std::vector<float> counts;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const float* p = v + i * stride;
+        uint64_t key = 0;
+        for (int k = 0; k < 3; ++k)
+        {
+            uint64_t c = static_cast<uint64_t>(std::min<float>((p[k] - lo[k]) * invCell, resolution - 1));
+            key = key * (resolution + 1) + c;
+        }
+
+        auto found = cells.find(key);
+        uint32_t target;
+        if (found == cells.end())
+        {
+            target = static_cast<uint32_t>(counts.size());
+            cells[key] = target;
+            counts.push_back(0.0f);
+            out.vertices.resize(out.vertices.size() + stride, 0.0f);
+        }
+        else
+        {
+            target = found->second;
+        }
+        remap[i] = target;
+        counts[target] += 1.0f;
+        for (size_t k = 0; k < stride; ++k)
+        {
+            out.vertices[target * stride + k] += p[k];
+        }
+    }
+
+    for (size_t t = 0; t < counts.size(); ++t)
+    {
+        float* p = &out.vertices[t * stride];
+        for (int k = 0; k < 3; ++k)
+        {
+            p[k] /= counts[t];
+        }
+        float length = std::sqrt(p[3] * p[3] + p[4] * p[4] + p[5] * p[5]);
+        if (length > 0.0f)
+        {
+            p[3] /= length;
+            p[4] /= length;
+            p[5] /= length;
+        }
+    }
+
+    for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
+    {
+        uint32_t a = remap[mesh.indices[i]], b = remap[mesh.indices[i + 1]], c = remap[mesh.indices[i + 2]];
+        if (a != b && b != c && a != c)
+        {
+            out.indices.push_back(a);
+            out.indices.push_back(b);
+            out.indices.push_back(c);
+        }
+    }
+    return out;
+}
+
+void fitMesh(Mesh& mesh, float radius, bool yUp)
+{
+    const size_t n = mesh.vertexCount();
+    if (n == 0)
+    {
+        return;
+    }
+
+    float* v = mesh.vertices.data();
+    const size_t stride = Mesh::FLOATS_PER_VERTEX;
+
+    // (x, y, z) -> (x, -z, y) for position and normal
+    if (yUp)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            float* p = v + i * stride;
+            for (int k = 0; k < 6; k += 3)
+            {
+                float y = p[k + 1];
+                p[k + 1] = -p[k + 2];
+                p[k + 2] = y;
+            }
+        }
+    }
+
+    // bounding box center
+    float lo[3] = { v[0], v[1], v[2] };
+    float hi[3] = { v[0], v[1], v[2] };
+    for (size_t i = 1; i < n; ++i)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            float c = v[i * stride + k];
+            if (c < lo[k]) lo[k] = c;
+            if (c > hi[k]) hi[k] = c;
+        }
+    }
+    float center[3] = { (lo[0] + hi[0]) * 0.5f, (lo[1] + hi[1]) * 0.5f, (lo[2] + hi[2]) * 0.5f };
+
+    float maxDistSq = 0.0f;
+    for (size_t i = 0; i < n; ++i)
+    {
+        float* p = v + i * stride;
+        p[0] -= center[0];
+        p[1] -= center[1];
+        p[2] -= center[2];
+        float d = p[0] * p[0] + p[1] * p[1] + p[2] * p[2];
+        if (d > maxDistSq) maxDistSq = d;
+    }
+
+    if (maxDistSq > 0.0f)
+    {
+        float scale = radius / std::sqrt(maxDistSq);
+        for (size_t i = 0; i < n; ++i)
+        {
+            float* p = v + i * stride;
+            p[0] *= scale;
+            p[1] *= scale;
+            p[2] *= scale;
+        }
+    }
+}
@@ -0,0 +1,40 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the indexed triangle mesh used to draw UAVs
+*/
+
+#ifndef MESH_H
+#define MESH_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// indexed triangle mesh, ready to upload to a vertex buffer as is
+struct Mesh
+{
+    static const size_t FLOATS_PER_VERTEX = 6;
+
+    std::vector<float> vertices;   // interleaved px, py, pz, nx, ny, nz
+    std::vector<uint32_t> indices; // three per triangle
+
+    size_t vertexCount() const { return vertices.size() / FLOATS_PER_VERTEX; }
+    size_t triangleCount() const { return indices.size() / 3; }
+    bool empty() const { return indices.empty(); }
+};
+
+// UV sphere, same tessellation parameters as glutSolidSphere
+Mesh makeSphereMesh(float radius, int slices, int stacks);
+
+// lower level of detail by vertex clustering: vertices falling in the same cell
+// of a resolution^3 grid over the mesh bounds merge into their average, and
+// triangles that collapse are dropped. Works on any model, keeps its outline
+Mesh simplifyMesh(const Mesh& mesh, int resolution);
+
+// center a loaded model on the origin and scale it to fit inside radius,
+// optionally turning a Y-up model (most OBJ exporters) into our Z-up world
+void fitMesh(Mesh& mesh, float radius, bool yUp = true);
+
+#endif
@@ -0,0 +1,291 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the swarm mission engine
+*/
+
+#include "MissionEngine.h"
+#include "MappedFile.h"
+#include "FastParse.h"
+#include <iostream>
+
+// one parsed line, uav = ALL_UAVS for "*"
+struct MissionEntry
+{
+    uint32_t uav;
+    float x, y, z;
+    float toleranceSq;
+};
+
+static const uint32_t ALL_UAVS = 0xffffffffu;
+
+// PathManager's rule: more lenient above 5 m
+static float toleranceFor(float z, float tolerance, float defaultTolerance)
+{
+    if (tolerance <= 0.0f)
+    {
+        tolerance = (z > 5.0f) ? defaultTolerance * 1.5f : defaultTolerance;
+    }
+    return tolerance * tolerance;
+}
+
+MissionEngine::MissionEngine() : launchBegin(0), launchEnd(0), looping(true)
+{
+}
+
+bool MissionEngine::load(const std::string& path, size_t numUAVs, float defaultTolerance)
+{
+    MappedFile file;
+    if (!file.open(path))
+    {
+        std::cerr << "Could not open mission file " << path << "\n";
+        return false;
+    }
+
+    const char* p = file.data();
+    const char* end = p + file.size();
+    std::vector<MissionEntry> entries;
+    size_t line = 0;
+
+    while (p < end)
+    {
+        ++line;
+        skipSpaces(p, end);
+        if (p >= end || *p == '\n' || *p == '#')
+        {
+            skipLine(p, end);
+            continue;
+        }
+
+        MissionEntry entry;
+        long uav = 0;
+        if (*p == '*')
+        {
+            entry.uav = ALL_UAVS;
+            ++p;
+        }
+        else if (parseInt(p, end, uav) && uav >= 0 && static_cast<size_t>(uav) < numUAVs)
+        {
+            entry.uav = static_cast<uint32_t>(uav);
+        }
+        else
+        {
+            std::cerr << path << ":" << line << ": bad UAV index (swarm has " << numUAVs << ")\n";
+            return false;
+        }
+
+        float coords[3];
+        for (int k = 0; k < 3; ++k)
+        {
+            skipSpaces(p, end);
+            if (!parseFloat(p, end, coords[k]))
+            {
+                std::cerr << path << ":" << line << ": expected uav x y z [tolerance]\n";
+                return false;
+            }
+        }
+        float tolerance = 0.0f;
+        skipSpaces(p, end);
+        parseFloat(p, end, tolerance);
+
+        entry.x = coords[0];
+        entry.y = coords[1];
+        entry.z = coords[2];
+        entry.toleranceSq = toleranceFor(entry.z, tolerance, defaultTolerance);
+        entries.push_back(entry);
+        skipLine(p, end);
+    }
+
+    // counting sort into per-UAV lists in UAV order, file order is kept
+    // within each UAV; the launch list (* lines only) goes last
+    std::vector<uint32_t> offsets(numUAVs + 2, 0);
+    for (const auto& e : entries)
+    {
+        if (e.uav == ALL_UAVS)
+        {
+            for (size_t i = 0; i <= numUAVs; ++i)
+            {
+                ++offsets[i + 1];
+            }
+        }
+        else
+        {
+            ++offsets[e.uav + 1];
+        }
+    }
+    for (size_t i = 0; i <= numUAVs; ++i)
+    {
+        offsets[i + 1] += offsets[i];
+    }
+
+    const size_t total = offsets[numUAVs + 1];
+    wpX.resize(total);
+    wpY.resize(total);
+    wpZ.resize(total);
+    wpToleranceSq.resize(total);
+
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (const auto& e : entries)
+    {
+        size_t first = (e.uav == ALL_UAVS) ? 0 : e.uav;
+        size_t last = (e.uav == ALL_UAVS) ? numUAVs + 1 : e.uav + 1;
+        for (size_t i = first; i < last; ++i)
+        {
+            uint32_t w = fill[i]++;
+            wpX[w] = e.x;
+            wpY[w] = e.y;
+            wpZ[w] = e.z;
+            wpToleranceSq[w] = e.toleranceSq;
+        }
+    }
+
+    listBegin.assign(offsets.begin(), offsets.begin() + numUAVs);
+    listEnd.assign(offsets.begin() + 1, offsets.begin() + numUAVs + 1);
+    launchBegin = offsets[numUAVs];
+    launchEnd = offsets[numUAVs + 1];
+    current.assign(numUAVs, 0);
+    return true;
+}
+
+// meant for building missions in code, load() builds large ones in one pass;
+// a list moved to the end leaves its old copy unused in the storage
+void MissionEngine::addWaypoint(size_t uav, float x, float y, float z, float tolerance, float defaultTolerance)
+{
+    if (uav >= listBegin.size())
+    {
+        listBegin.resize(uav + 1, 0);
+        listEnd.resize(uav + 1, 0);
+    }
+
+    const uint32_t stored = static_cast<uint32_t>(wpX.size());
+    if (listEnd[uav] != stored)
+    {
+        for (uint32_t w = listBegin[uav]; w < listEnd[uav]; ++w)
+        {
+            wpX.push_back(wpX[w]);
+            wpY.push_back(wpY[w]);
+            wpZ.push_back(wpZ[w]);
+            wpToleranceSq.push_back(wpToleranceSq[w]);
+        }
+        listBegin[uav] = stored;
+    }
+
+    wpX.push_back(x);
+    wpY.push_back(y);
+    wpZ.push_back(z);
+    wpToleranceSq.push_back(toleranceFor(z, tolerance, defaultTolerance));
+    listEnd[uav] = static_cast<uint32_t>(wpX.size());
+}
+
+void MissionEngine::setLooping(bool enabled)
+{
+    looping = enabled;
+}
+
+void MissionEngine::reset(SwarmState& swarm)
+{
+    const size_t count = swarm.size();
+    listBegin.resize(count, launchBegin);
+    listEnd.resize(count, launchEnd);
+    current.assign(count, 0);
+    toleranceSq.assign(count, -1.0f);
+    followSphere.assign(count, 1.0f);
+    laps.assign(count, 0);
+    for (size_t i = 0; i < count; ++i)
+    {
+        start(swarm, i);
+    }
+}
+
+void MissionEngine::start(SwarmState& swarm, size_t uav)
+{
+    const uint32_t first = listBegin[uav];
+    current[uav] = first;
+    laps[uav] = 0;
+    if (first == listEnd[uav])
+    {
+        // sphere target is refreshed every tick by the kernel
+        const SwarmParams& p = swarm.params;
+        followSphere[uav] = 1.0f;
+        toleranceSq[uav] = -1.0f;
+        swarm.targetX[uav] = p.centerX;
+        swarm.targetY[uav] = p.centerY;
+        swarm.targetZ[uav] = p.centerZ + p.radius;
+        return;
+    }
+    followSphere[uav] = 0.0f;
+    toleranceSq[uav] = wpToleranceSq[first];
+    swarm.targetX[uav] = wpX[first];
+    swarm.targetY[uav] = wpY[first];
+    swarm.targetZ[uav] = wpZ[first];
+}
+
+void MissionEngine::addUAV(SwarmState& swarm)
+{
+    listBegin.push_back(launchBegin);
+    listEnd.push_back(launchEnd);
+    current.push_back(launchBegin);
+    toleranceSq.push_back(-1.0f);
+    followSphere.push_back(1.0f);
+    laps.push_back(0);
+    start(swarm, current.size() - 1);
+}
+
+void MissionEngine::removeUAV(size_t index)
+{
+    const size_t last = current.size() - 1;
+    listBegin[index] = listBegin[last];
+    listEnd[index] = listEnd[last];
+    current[index] = current[last];
+    toleranceSq[index] = toleranceSq[last];
+    followSphere[index] = followSphere[last];
+    laps[index] = laps[last];
+    listBegin.pop_back();
+    listEnd.pop_back();
+    current.pop_back();
+    toleranceSq.pop_back();
+    followSphere.pop_back();
+    laps.pop_back();
+}
+
+void MissionEngine::reserve(size_t capacity)
+{
+    listBegin.reserve(capacity);
+    listEnd.reserve(capacity);
+    current.reserve(capacity);
+    toleranceSq.reserve(capacity);
+    followSphere.reserve(capacity);
+    laps.reserve(capacity);
+}
+
+void MissionEngine::advance(SwarmState& swarm, size_t uav)
+{
+    uint32_t next = current[uav] + 1;
+    if (next == listEnd[uav])
+    {
+        ++laps[uav];
+        if (!looping)
+        {
+            toleranceSq[uav] = -1.0f; // hold at the last waypoint
+            return;
+        }
+        next = listBegin[uav];
+    }
+
+    current[uav] = next;
+    toleranceSq[uav] = wpToleranceSq[next];
+    swarm.targetX[uav] = wpX[next];
+    swarm.targetY[uav] = wpY[next];
+    swarm.targetZ[uav] = wpZ[next];
+}
+
+size_t MissionEngine::countCompleted() const
+{
+    size_t completed = 0;
+    for (uint32_t lap : laps)
+    {
+        completed += (lap > 0);
+    }
+    return completed;
+}
@@ -0,0 +1,100 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the swarm mission engine. Every UAV flies its own
+waypoint list; the lists of the whole swarm are stored back to back in flat
+arrays (UAV i flies waypoints [listBegin[i], listEnd[i])), and the per-UAV state
+the kernels touch every tick (current tolerance, sphere flag) is kept in flat
+arrays indexed by UAV. Reaching a waypoint is tested for the whole swarm in SIMD
+form by missionTargetsRange (SwarmKernels.h); only UAVs that did reach theirs
+call advance(). UAVs without waypoints orbit the SwarmParams sphere.
+
+The per-UAV arrays follow SwarmState when UAVs are added or swap-removed (see
+SwarmPool). A removed UAV's waypoints stay in storage unused; UAVs added later
+all share the launch list.
+
+Mission file, one waypoint per line, '#' starts a comment:
+    uav x y z [tolerance]
+uav is a 0-based index or * for every UAV, including UAVs added later. Without a
+tolerance the default is used, 1.5x above 5 m altitude like PathManager in
+PID_Sim.h.
+*/
+
+#ifndef MISSION_ENGINE_H
+#define MISSION_ENGINE_H
+
+#include "SwarmState.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+class MissionEngine
+{
+public:
+    // waypoint storage; lists need not be in UAV order and may be shared
+    FloatArray wpX, wpY, wpZ;
+    FloatArray wpToleranceSq;
+
+    // per UAV: its list in the waypoint storage (empty = orbit the sphere)
+    std::vector<uint32_t> listBegin, listEnd;
+
+    // list given to UAVs added later (the * waypoints of the mission file)
+    uint32_t launchBegin, launchEnd;
+
+    // per UAV: flat index of the waypoint being flown to, its squared tolerance
+    // (-1 = never reached: orbiting or holding at the end), 1 = orbit the sphere
+    std::vector<uint32_t> current;
+    FloatArray toleranceSq;
+    FloatArray followSphere;
+
+    // completed passes over the whole list, per UAV
+    std::vector<uint32_t> laps;
+
+    MissionEngine();
+
+    // read a mission file for numUAVs UAVs, returns false (and reports the
+    // line) on a parse error or an out of range UAV index
+    bool load(const std::string& path, size_t numUAVs, float defaultTolerance = 1.0f);
+
+    // append one waypoint to a UAV's list (tolerance <= 0 uses the altitude
+    // rule); a list that does not end the storage is copied to the end first,
+    // so build lists one UAV at a time
+    void addWaypoint(size_t uav, float x, float y, float z, float tolerance, float defaultTolerance = 1.0f);
+
+    // after the last waypoint: start over (default) or hold position there
+    void setLooping(bool enabled);
+    bool isLooping() const { return looping; }
+
+    // restart every mission and write the first targets into the swarm;
+    // UAVs beyond the loaded lists fly the launch list
+    void reset(SwarmState& swarm);
+
+    // swarm gained a UAV at its last index: it starts on the launch list
+    void addUAV(SwarmState& swarm);
+
+    // same swap-remove as SwarmState::removeUAV (the last UAV moves to index)
+    void removeUAV(size_t index);
+
+    // room for capacity UAVs, so adding them does not allocate
+    void reserve(size_t capacity);
+
+    // uav reached its current waypoint: move on and write its new target
+    void advance(SwarmState& swarm, size_t uav);
+
+    size_t size() const { return current.size(); }
+    size_t waypointCount() const { return wpX.size(); }
+    size_t waypointCount(size_t uav) const { return listEnd[uav] - listBegin[uav]; }
+
+    // UAVs that flew their list at least once
+    size_t countCompleted() const;
+
+private:
+    // point uav at the start of its list and write its first target
+    void start(SwarmState& swarm, size_t uav);
+
+    bool looping;
+};
+
+#endif
@@ -0,0 +1,352 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the Wavefront OBJ loader and its binary mesh cache
+*/
+
+#include "ObjLoader.h"
+#include "MappedFile.h"
+#include "FastParse.h"
+#include <unordered_map>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <sys/stat.h>
+
+// cache file layout: header, vertex floats, indices
+struct MeshCacheHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint64_t sourceSize;
+    int64_t sourceMtime;
+    uint64_t vertexFloats;
+    uint64_t indexCount;
+};
+
+static const char CACHE_MAGIC[4] = { 'U', 'A', 'V', 'M' };
+static const uint32_t CACHE_VERSION = 1;
+
+// resolve a 1-based (or negative, relative) OBJ index, -1 if out of range
+static long resolveIndex(long index, size_t count)
+{
+    long resolved = (index < 0) ? static_cast<long>(count) + index : index - 1;
+    return (resolved >= 0 && resolved < static_cast<long>(count)) ? resolved : -1;
+}
+
+bool parseObj(const char* data, size_t size, Mesh& mesh)
+{
+    const char* p = data;
+    const char* end = data + size;
+
+    std::vector<float> positions;
+    std::vector<float> normals;
+
+    // (position, normal) pair -> output vertex
+    std::unordered_map<uint64_t, uint32_t> vertexOf;
+    std::vector<bool> needsNormal;
+
+    mesh.vertices.clear();
+    mesh.indices.clear();
+
+    // face corners of the current polygon, before triangulation
+    std::vector<uint32_t> polygon;
+
+    while (p < end)
+    {
+        skipSpaces(p, end);
+        if (p + 1 >= end)
+        {
+            break;
+        }
+
+        if (p[0] == 'v' && (p[1] == ' ' || p[1] == '\t'))
+        {
+            p += 2;
+            for (int k = 0; k < 3; ++k)
+            {
+                float value = 0.0f;
+                skipSpaces(p, end);
+                parseFloat(p, end, value);
+                positions.push_back(value);
+            }
+        }
+        else if (p[0] == 'v' && p[1] == 'n')
+        {
+            p += 2;
+            for (int k = 0; k < 3; ++k)
+            {
+                float value = 0.0f;
+                skipSpaces(p, end);
+                parseFloat(p, end, value);
+                normals.push_back(value);
+            }
+        }
+        else if (p[0] == 'f' && (p[1] == ' ' || p[1] == '\t'))
+        {
+            p += 2;
+            polygon.clear();
+
+            const size_t numPositions = positions.size() / 3;
+            const size_t numNormals = normals.size() / 3;
+
+            while (true)
+            {
+                skipSpaces(p, end);
+                long v = 0, vn = 0;
+                if (!parseInt(p, end, v))
+                {
+                    break;
+                }
+
+                // v, v/vt, v//vn or v/vt/vn (texture coordinates are not used)
+                if (p < end && *p == '/')
+                {
+                    ++p;
+                    long vt = 0;
+                    parseInt(p, end, vt);
+                    if (p < end && *p == '/')
+                    {
+                        ++p;
+                        parseInt(p, end, vn);
+                    }
+                }
+
+                long pos = resolveIndex(v, numPositions);
+                if (pos < 0)
+                {
+                    continue; // broken reference, drop the corner
+                }
+                long norm = (vn != 0) ? resolveIndex(vn, numNormals) : -1;
+
+                uint64_t key = (static_cast<uint64_t>(pos) << 32) | static_cast<uint32_t>(norm + 1);
+                auto found = vertexOf.find(key);
+                uint32_t index;
+                if (found != vertexOf.end())
+                {
+                    index = found->second;
+                }
+                else
+                {
+                    index = static_cast<uint32_t>(mesh.vertexCount());
+                    vertexOf.insert(std::make_pair(key, index));
+
+                    mesh.vertices.push_back(positions[pos * 3]);
+                    mesh.vertices.push_back(positions[pos * 3 + 1]);
+                    mesh.vertices.push_back(positions[pos * 3 + 2]);
+                    if (norm >= 0)
+                    {
+                        mesh.vertices.push_back(normals[norm * 3]);
+                        mesh.vertices.push_back(normals[norm * 3 + 1]);
+                        mesh.vertices.push_back(normals[norm * 3 + 2]);
+                    }
+                    else
+                    {
+                        mesh.vertices.push_back(0.0f);
+                        mesh.vertices.push_back(0.0f);
+                        mesh.vertices.push_back(0.0f);
+                    }
+                    needsNormal.push_back(norm < 0);
+                }
+                polygon.push_back(index);
+            }
+
+            // triangle fan
+            for (size_t k = 1; k + 1 < polygon.size(); ++k)
+            {
+                mesh.indices.push_back(polygon[0]);
+                mesh.indices.push_back(polygon[k]);
+                mesh.indices.push_back(polygon[k + 1]);
+            }
+        }
+
+        skipLine(p, end);
+    }
+
+    // smooth normals for vertices the file gave none: sum of adjacent face normals
+    bool anyMissing = false;
+    for (bool missing : needsNormal)
+    {
+        anyMissing = anyMissing || missing;
+    }
+    if (anyMissing)
+    {
+        float* v = mesh.vertices.data();
+        const size_t stride = Mesh::FLOATS_PER_VERTEX;
+        for (size_t t = 0; t + 2 < mesh.indices.size(); t += 3)
+        {
+            float* a = v + mesh.indices[t] * stride;
+            float* b = v + mesh.indices[t + 1] * stride;
+            float* c = v + mesh.indices[t + 2] * stride;
+
+            float e1x = b[0] - a[0], e1y = b[1] - a[1], e1z = b[2] - a[2];
+            float e2x = c[0] - a[0], e2y = c[1] - a[1], e2z = c[2] - a[2];
+            float nx = e1y * e2z - e1z * e2y;
+            float ny = e1z * e2x - e1x * e2z;
+            float nz = e1x * e2y - e1y * e2x;
+
+            float* corners[3] = { a, b, c };
+            for (int k = 0; k < 3; ++k)
+            {
+                if (needsNormal[mesh.indices[t + k]])
+                {
+                    corners[k][3] += nx;
+                    corners[k][4] += ny;
+                    corners[k][5] += nz;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < mesh.vertexCount(); ++i)
+        {
+            if (!needsNormal[i])
+            {
+                continue;
+            }
+            float* n = v + i * stride + 3;
+            float len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            if (len > 0.0f)
+            {
+                n[0] /= len;
+                n[1] /= len;
+                n[2] /= len;
+            }
+        }
+    }
+
+    return !mesh.empty();
+}
+
+std::string meshCachePath(const std::string& objPath)
+{
+    return objPath + ".meshcache";
+}
+
+// size and modification time of the source OBJ, false if it does not exist
+static bool sourceStamp(const std::string& objPath, uint64_t& size, int64_t& mtime)
+{
+    struct stat st;
+    if (stat(objPath.c_str(), &st) != 0)
+    {
+        return false;
+    }
+    size = static_cast<uint64_t>(st.st_size);
+    mtime = static_cast<int64_t>(st.st_mtime);
+    return true;
+}
+
+bool readMeshCache(const std::string& objPath, Mesh& mesh)
+{
+    uint64_t srcSize = 0;
+    int64_t srcMtime = 0;
+    if (!sourceStamp(objPath, srcSize, srcMtime))
+    {
+        return false;
+    }
+
+    MappedFile file;
+    if (!file.open(meshCachePath(objPath)) || file.size() < sizeof(MeshCacheHeader))
+    {
+        return false;
+    }
+
+    MeshCacheHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, CACHE_MAGIC, 4) != 0 || header.version != CACHE_VERSION
+        || header.sourceSize != srcSize || header.sourceMtime != srcMtime)
+    {
+        return false; // stale or foreign
+    }
+
+    // whole vertices and triangles, sizes checked before multiplying so a
+    // corrupt count cannot wrap around to match the file size
+    const size_t payloadBytes = file.size() - sizeof(header);
+    if (header.vertexFloats % Mesh::FLOATS_PER_VERTEX != 0 || header.indexCount % 3 != 0
+        || header.vertexFloats > payloadBytes / sizeof(float)
+        || header.indexCount > payloadBytes / sizeof(uint32_t))
+    {
+        return false;
+    }
+    const size_t vertexBytes = header.vertexFloats * sizeof(float);
+    const size_t indexBytes = header.indexCount * sizeof(uint32_t);
+    if (payloadBytes != vertexBytes + indexBytes)
+    {
+        return false;
+    }
+
+    const char* payload = file.data() + sizeof(header);
+    mesh.vertices.resize(header.vertexFloats);
+    mesh.indices.resize(header.indexCount);
+    std::memcpy(mesh.vertices.data(), payload, vertexBytes);
+    std::memcpy(mesh.indices.data(), payload + vertexBytes, indexBytes);
+
+    // every index names a vertex, otherwise drop the cache and re-parse
+    const size_t vertexCount = mesh.vertexCount();
+    for (size_t i = 0; i < mesh.indices.size(); ++i)
+    {
+        if (mesh.indices[i] >= vertexCount)
+        {
+            mesh.vertices.clear();
+            mesh.indices.clear();
+            return false;
+        }
+    }
+    return !mesh.empty();
+}
+
+bool writeMeshCache(const std::string& objPath, const Mesh& mesh)
+{
+    MeshCacheHeader header;
+    std::memcpy(header.magic, CACHE_MAGIC, 4);
+    header.version = CACHE_VERSION;
+    if (!sourceStamp(objPath, header.sourceSize, header.sourceMtime))
+    {
+        return false;
+    }
+    header.vertexFloats = mesh.vertices.size();
+    header.indexCount = mesh.indices.size();
+
+    // write to a temporary name then rename, readers never see half a cache
+    const std::string path = meshCachePath(objPath);
+    const std::string tmpPath = path + ".tmp";
+    FILE* out = std::fopen(tmpPath.c_str(), "wb");
+    if (!out)
+    {
+        return false; // e.g. read-only directory, caching is optional
+    }
+
+    bool ok = std::fwrite(&header, sizeof(header), 1, out) == 1
+           && std::fwrite(mesh.vertices.data(), sizeof(float), mesh.vertices.size(), out) == mesh.vertices.size()
+           && std::fwrite(mesh.indices.data(), sizeof(uint32_t), mesh.indices.size(), out) == mesh.indices.size();
+    ok = (std::fclose(out) == 0) && ok;
+
+    std::remove(path.c_str());
+    if (!ok || std::rename(tmpPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool loadObj(const std::string& path, Mesh& mesh, bool useCache)
+{
+    if (useCache && readMeshCache(path, mesh))
+    {
+        return true;
+    }
+
+    MappedFile file;
+    if (!file.open(path) || !parseObj(file.data(), file.size(), mesh))
+    {
+        return false;
+    }
+
+    if (useCache)
+    {
+        writeMeshCache(path, mesh);
+    }
+    return true;
+}
@@ -0,0 +1,30 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the Wavefront OBJ mesh loader. The OBJ text is memory
+mapped and parsed in place, (position, normal) pairs are deduplicated into an
+indexed vertex buffer, and the result is stored in a binary cache next to the
+OBJ so later startups load it with a single mapping.
+*/
+
+#ifndef OBJ_LOADER_H
+#define OBJ_LOADER_H
+
+#include "Mesh.h"
+#include <string>
+#include <cstddef>
+
+// parse OBJ text already in memory (v, vn, f; polygons are fan triangulated,
+// negative indices allowed, missing normals are computed from the faces)
+bool parseObj(const char* data, size_t size, Mesh& mesh);
+
+// load an OBJ file, using (and refreshing) "<path>.meshcache" when useCache is set
+bool loadObj(const std::string& path, Mesh& mesh, bool useCache = true);
+
+// binary cache helpers, the cache is tied to the OBJ's size and modification time
+std::string meshCachePath(const std::string& objPath);
+bool readMeshCache(const std::string& objPath, Mesh& mesh);
+bool writeMeshCache(const std::string& objPath, const Mesh& mesh);
+
+#endif
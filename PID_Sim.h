@@ -0,0 +1,635 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: PID controllers, waypoints, and UAV physics for the single-UAV path
+simulation. Kept in namespace pidsim because its PIDController differs from the
+one in ECE_UAV.h and both are linked into the benchmarks.
+*/
+
+#ifndef PID_SIM_H
+#define PID_SIM_H
+
+#include "VecMath.h"
+#include "AsyncLog.h"
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <iomanip>
+#include <algorithm>
+
+namespace pidsim
+{
+
+// 3D Vector for position, velocity, and forces (4-lane layout, see VecMath.h)
+typedef Vec3d Vec3;
+
+// Time step policies. dt() is the step and rate(delta) turns a per-step change
+// into a per-second one. VariableStep takes dt at runtime (and guards dt <= 0);
+// FixedRate<Hz> folds both into constants, so 1/dt is a compile-time multiply
+struct VariableStep
+{
+    double step;
+    
+    explicit VariableStep(double dt) : step(dt) {}
+    double dt() const { return step; }
+    double rate(double delta) const { return (step > 0) ? delta / step : 0.0; }
+};
+
+template <int Hz>
+struct FixedRate
+{
+    static_assert(Hz > 0, "FixedRate needs a positive rate");
+    
+    constexpr double dt() const { return 1.0 / Hz; }
+    constexpr double rate(double delta) const { return delta * Hz; }
+};
+
+// PID Controller class with improved control
+class PIDController
+{
+private:
+    double kp, ki, kd;
+    double integral;
+    double prev_error;
+    double integral_limit;
+    double output_limit;
+    
+public:
+    PIDController(double kp = 1.0, double ki = 0.0, double kd = 0.0, 
+                  double integral_limit = 100.0, double output_limit = 50.0) 
+        : kp(kp), ki(ki), kd(kd), integral(0), prev_error(0), 
+          integral_limit(integral_limit), output_limit(output_limit) {}
+    
+    double calculate(double error, double dt)
+    {
+        return calculate(error, VariableStep(dt));
+    }
+    
+    // Same law with the time step as a policy (see FixedRate)
+    template <class Step>
+    double calculate(double error, Step step)
+    {
+        // Proportional term
+        double p_term = kp * error;
+        
+        // Integral term with anti-windup (min/max compile to branch-free clamps)
+        integral += error * step.dt();
+        integral = std::max(-integral_limit, std::min(integral_limit, integral));
+        double i_term = ki * integral;
+        
+        // Derivative term (with filter for noise reduction)
+        double derivative = step.rate(error - prev_error);
+        double d_term = kd * derivative;
+        
+        prev_error = error;
+        
+        // Calculate total output
+        double output = p_term + i_term + d_term;
+        
+        // Limit output
+        return std::max(-output_limit, std::min(output_limit, output));
+    }
+    
+    // Reset controller state
+    void reset()
+    {
+        integral = 0;
+        prev_error = 0;
+    }
+    
+    void setGains(double p, double i, double d)
+    {
+        kp = p;
+        ki = i;
+        kd = d;
+    }
+    
+    double getIntegral() const
+    {
+        return integral;
+    }
+};
+
+// Kp, Ki, Kd of one PID loop
+struct PIDGains
+{
+    double kp, ki, kd;
+};
+
+// gains of both cascade loops, X/Y share one set and Z (altitude) has its own
+struct CascadeGains
+{
+    PIDGains pos_xy;  // position -> desired velocity
+    PIDGains pos_z;
+    PIDGains vel_xy;  // velocity -> force
+    PIDGains vel_z;
+
+    // hand-tuned defaults for the 1 kg airframe
+    static CascadeGains defaults()
+    {
+        CascadeGains g;
+        g.pos_xy = { 4.0, 0.2, 2.0 };
+        g.pos_z  = { 5.0, 0.3, 2.5 };   // Higher gains for Z (altitude)
+        g.vel_xy = { 3.0, 0.1, 0.5 };
+        g.vel_z  = { 4.0, 0.2, 0.8 };
+        return g;
+    }
+};
+
+// UAV class with improved physics and control
+class UAV
+{
+private:
+    Vec3 position;
+    Vec3 velocity;
+    Vec3 acceleration;
+    double mass;
+    double max_force_per_axis;  // Maximum force per axis
+    double drag_coefficient;
+    double gravity_compensation;
+    
+    // PID controllers for each axis
+    PIDController pid_x;
+    PIDController pid_y;
+    PIDController pid_z;
+    
+    // Velocity controller (cascade control)
+    PIDController pid_vx;
+    PIDController pid_vy;
+    PIDController pid_vz;
+    
+public:
+    UAV(Vec3 initial_pos = Vec3(0, 0, 0), double mass = 1.0, double max_force = 30.0) 
+        : position(initial_pos), velocity(0, 0, 0), acceleration(0, 0, 0),
+          mass(mass), max_force_per_axis(max_force), drag_coefficient(0.05)
+    {
+        setGains(CascadeGains::defaults());
+        
+        // Calculate gravity compensation
+        gravity_compensation = 9.81 * mass;
+    }
+    
+    // Set the gains of both cascade loops
+    void setGains(const CascadeGains& gains)
+    {
+        // Position PID controllers - generates desired velocity
+        pid_x.setGains(gains.pos_xy.kp, gains.pos_xy.ki, gains.pos_xy.kd);
+        pid_y.setGains(gains.pos_xy.kp, gains.pos_xy.ki, gains.pos_xy.kd);
+        pid_z.setGains(gains.pos_z.kp, gains.pos_z.ki, gains.pos_z.kd);
+        
+        // Velocity PID controllers - generates force commands
+        pid_vx.setGains(gains.vel_xy.kp, gains.vel_xy.ki, gains.vel_xy.kd);
+        pid_vy.setGains(gains.vel_xy.kp, gains.vel_xy.ki, gains.vel_xy.kd);
+        pid_vz.setGains(gains.vel_z.kp, gains.vel_z.ki, gains.vel_z.kd);
+    }
+    
+    // Calculate control forces using cascade PID (position -> velocity -> force)
+    Vec3 calculateControlForces(const Vec3& target, double dt)
+    {
+        return calculateControlForces(target, VariableStep(dt));
+    }
+    
+    template <class Step>
+    Vec3 calculateControlForces(const Vec3& target, Step dt)
+    {
+        // Position error
+        Vec3 pos_error = target - position;
+        
+        // Calculate desired velocity from position error (outer loop)
+        double desired_vx = pid_x.calculate(pos_error.x, dt);
+        double desired_vy = pid_y.calculate(pos_error.y, dt);
+        double desired_vz = pid_z.calculate(pos_error.z, dt);
+        
+        // Limit desired velocity to reasonable values
+        double max_velocity = 10.0;
+        desired_vx = std::max(-max_velocity, std::min(max_velocity, desired_vx));
+        desired_vy = std::max(-max_velocity, std::min(max_velocity, desired_vy));
+        desired_vz = std::max(-max_velocity, std::min(max_velocity, desired_vz));
+        
+        // Velocity error
+        double vel_error_x = desired_vx - velocity.x;
+        double vel_error_y = desired_vy - velocity.y;
+        double vel_error_z = desired_vz - velocity.z;
+        
+        // Calculate force from velocity error (inner loop)
+        double force_x = pid_vx.calculate(vel_error_x, dt);
+        double force_y = pid_vy.calculate(vel_error_y, dt);
+        double force_z = pid_vz.calculate(vel_error_z, dt);
+        
+        // Add gravity compensation to Z force (feed-forward term)
+        force_z += gravity_compensation;
+        
+        // Apply per-axis force limits
+        Vec3 force(force_x, force_y, force_z);
+        return force.clamp(-max_force_per_axis, max_force_per_axis);
+    }
+    
+    // Alternative: Simple P-D controller with feed-forward for better stability
+    Vec3 calculateSimpleControlForces(const Vec3& target, double dt)
+    {
+        Vec3 pos_error = target - position;
+        
+        // Position control with velocity damping
+        double kp_pos = 5.0;
+        double kd_vel = 3.0;
+        
+        Vec3 force;
+        force.x = kp_pos * pos_error.x - kd_vel * velocity.x;
+        force.y = kp_pos * pos_error.y - kd_vel * velocity.y;
+        force.z = kp_pos * pos_error.z - kd_vel * velocity.z + gravity_compensation;
+        
+        // Apply force limits
+        return force.clamp(-max_force_per_axis, max_force_per_axis);
+    }
+    
+    // Update UAV physics
+    void update(const Vec3& control_force, double dt)
+    {
+        update(control_force, VariableStep(dt));
+    }
+    
+    template <class Step>
+    void update(const Vec3& control_force, Step step)
+    {
+        const double dt = step.dt();
+        
+        // Total force accumulated in place: control, drag (proportional to
+        // velocity squared for more realism), gravity (Z axis only)
+        acceleration = control_force;
+        acceleration.x -= drag_coefficient * velocity.x * std::abs(velocity.x);
+        acceleration.y -= drag_coefficient * velocity.y * std::abs(velocity.y);
+        acceleration.z -= drag_coefficient * velocity.z * std::abs(velocity.z);
+        acceleration.z -= 9.81 * mass;
+        
+        // Newton's second law: F = ma
+        acceleration /= mass;
+        
+        // Update velocity and position using Euler integration
+        velocity.addScaled(acceleration, dt);
+        position.addScaled(velocity, dt);
+        
+        // Optional: Add ground constraint
+        if (position.z < 0)
+        {
+            position.z = 0;
+            if (velocity.z < 0) velocity.z = 0;
+        }
+    }
+    
+    // Getters
+    Vec3 getPosition() const
+    {
+        return position;
+    }
+    Vec3 getVelocity() const
+    {
+        return velocity;
+    }
+    Vec3 getAcceleration() const
+    {
+        return acceleration;
+    }
+    
+    // Reset all controllers
+    void resetControllers()
+    {
+        pid_x.reset();
+        pid_y.reset();
+        pid_z.reset();
+        pid_vx.reset();
+        pid_vy.reset();
+        pid_vz.reset();
+    }
+    
+    // Set position (for testing)
+    void setPosition(const Vec3& pos)
+    {
+        position = pos;
+        velocity = Vec3(0, 0, 0);
+        acceleration = Vec3(0, 0, 0);
+        resetControllers();
+    }
+};
+
+// Path manager for waypoint navigation
+class PathManager
+{
+private:
+    std::vector<Vec3> waypoints;
+    size_t current_waypoint_index;
+    double waypoint_tolerance;
+    double approach_speed_factor;
+    bool verbose;
+    
+public:
+    PathManager(double tolerance = 1.0) 
+        : current_waypoint_index(0), waypoint_tolerance(tolerance),
+          approach_speed_factor(1.0), verbose(true) {}
+    
+    // Print a line when a waypoint is reached
+    void setVerbose(bool enabled)
+    {
+        verbose = enabled;
+    }
+    
+    // Add one waypoint
+    void addWaypoint(const Vec3& point)
+    {
+        waypoints.push_back(point);
+    }
+    
+    // Add multiple waypoints
+    void addWaypoints(const std::vector<Vec3>& points)
+    {
+        waypoints.insert(waypoints.end(), points.begin(), points.end());
+    }
+    
+    // Return current target waypoint
+    Vec3 getCurrentTarget() const
+    {
+        if (waypoints.empty()) return Vec3(0, 0, 0);
+        return waypoints[current_waypoint_index];
+    }
+    
+    // Update target waypoint if reached
+    bool updateTarget(const Vec3& current_position)
+    {
+        if (waypoints.empty()) return false;
+        
+        // Check if UAV reached current waypoint (squared, no sqrt per step)
+        double distance_sq = current_position.distanceSquared(waypoints[current_waypoint_index]);
+        
+        // Dynamic tolerance based on altitude (more lenient at higher altitudes)
+        double dynamic_tolerance = waypoint_tolerance;
+        if (waypoints[current_waypoint_index].z > 5)
+        {
+            dynamic_tolerance = waypoint_tolerance * 1.5;
+        }
+        
+        if (distance_sq < dynamic_tolerance * dynamic_tolerance)
+        {
+            if (verbose)
+            {
+                AsyncLog::text("Reached waypoint {} (distance: {.2})",
+                               current_waypoint_index + 1, std::sqrt(distance_sq));
+            }
+            current_waypoint_index++;
+            if (current_waypoint_index >= waypoints.size())
+            {
+                current_waypoint_index = 0;  // Loop back to start
+                return true;  // Path completed
+            }
+        }
+        return false;
+    }
+    
+    bool hasWaypoints() const
+    {
+        return !waypoints.empty();
+    }
+    size_t getCurrentIndex() const
+    {
+        return current_waypoint_index;
+    }
+    size_t getWaypointCount() const
+    {
+        return waypoints.size();
+    }
+    void reset()
+    {
+        current_waypoint_index = 0;
+    }
+};
+
+// Controller policies for Simulation::runWith, picked at compile time so the
+// per-step loop has no strategy branch and inlines fully
+struct CascadePID
+{
+    static const char* name() { return "Cascade PID"; }
+    
+    template <class Step>
+    static Vec3 forces(UAV& uav, const Vec3& target, Step step)
+    {
+        return uav.calculateControlForces(target, step);
+    }
+};
+
+struct SimplePDFF
+{
+    static const char* name() { return "Simple PD+FF"; }
+    
+    template <class Step>
+    static Vec3 forces(UAV& uav, const Vec3& target, Step step)
+    {
+        return uav.calculateSimpleControlForces(target, step.dt());
+    }
+};
+
+// Statistics of one Simulation::run
+struct SimulationResult
+{
+    double min_error;
+    double max_error;
+    double avg_error;
+    double settling_time;      // time the path was first completed, or the duration if never
+    size_t waypoints_reached;
+    bool completed;
+    Vec3 final_position;
+};
+
+// Simulation class
+class Simulation
+{
+private:
+    UAV uav;
+    PathManager path_manager;
+    double simulation_time;
+    double dt;
+    bool verbose;
+    bool use_cascade_control;
+    bool telemetry;
+    
+public:
+    Simulation(double timestep = 0.01, bool verbose = true, bool cascade = true) 
+        : uav(Vec3(0, 0, 0)), simulation_time(0), dt(timestep), 
+          verbose(verbose), use_cascade_control(cascade), telemetry(false)
+    {
+        path_manager.setVerbose(verbose);
+    }
+    
+    // Log a "uav" telemetry row (time, position, target, force) every step,
+    // needs AsyncLog::openTelemetry
+    void setTelemetry(bool enabled)
+    {
+        telemetry = enabled;
+    }
+    
+    // Replace the UAV's cascade gains (used by the gain tuner)
+    void setGains(const CascadeGains& gains)
+    {
+        uav.setGains(gains);
+    }
+    
+    void setupPath()
+    {
+        // Create a 3D path with multiple waypoints
+        path_manager.addWaypoints(
+        {
+            Vec3(0, 0, 5),      // Take off
+            Vec3(10, 0, 5),     // Move forward
+            Vec3(10, 10, 5),    // Move right
+            Vec3(10, 10, 10),   // Climb
+            Vec3(0, 10, 10),    // Move back
+            Vec3(0, 0, 10),     // Complete square at altitude
+            Vec3(0, 0, 0)       // Land
+        });
+    }
+    
+    void setupSimplePath()
+    {
+        // Simpler path for testing
+        path_manager.addWaypoints(
+        {
+            Vec3(0, 0, 2),      // Small takeoff
+            Vec3(5, 0, 2),      // Move forward
+            Vec3(5, 5, 2),      // Move right
+            Vec3(0, 5, 2),      // Move back
+            Vec3(0, 0, 2),      // Return to start
+            Vec3(0, 0, 0)       // Land
+        });
+    }
+    
+    // Full simulation loop, prints nothing unless verbose
+    SimulationResult run(double duration)
+    {
+        // choose the controller once, not every step
+        if (use_cascade_control)
+        {
+            return runWith<CascadePID>(duration, VariableStep(dt));
+        }
+        return runWith<SimplePDFF>(duration, VariableStep(dt));
+    }
+    
+    // Simulation loop specialized for one controller and time step policy, e.g.
+    // runWith<CascadePID>(30.0, FixedRate<100>()); the step replaces the timestep
+    // given to the constructor
+    template <class Controller, class Step>
+    SimulationResult runWith(double duration, Step step)
+    {
+        if (verbose)
+        {
+            AsyncLog::flush(); // keep order with lines still queued from earlier runs
+            std::cout << "\n=== UAV PID Path Control Simulation ===\n";
+            std::cout << "Control mode: " << Controller::name() << "\n";
+            std::cout << "Simulation duration: " << duration << " seconds\n";
+            std::cout << "Time step: " << step.dt() << " seconds\n\n";
+        }
+        
+        int display_counter = 0;
+        int display_interval = 50;  // Display every 50 iterations (0.5 seconds)
+        
+        double min_error = 999999;
+        double max_error = 0;
+        double total_error = 0;
+        int error_samples = 0;
+        
+        SimulationResult result;
+        result.settling_time = duration;
+        result.waypoints_reached = 0;
+        result.completed = false;
+        
+        while (simulation_time < duration && path_manager.hasWaypoints())
+        {
+            // Get current target waypoint
+            Vec3 target = path_manager.getCurrentTarget();
+            
+            // Calculate control forces
+            Vec3 control_force = Controller::forces(uav, target, step);
+            
+            // Update UAV physics
+            uav.update(control_force, step);
+            
+            if (telemetry)
+            {
+                const Vec3& p = uav.getPosition();
+                AsyncLog::telemetry("uav", simulation_time, p.x, p.y, p.z, target.x, target.y, target.z,
+                                    control_force.x, control_force.y, control_force.z);
+            }
+            
+            // Track error statistics
+            double error = uav.getPosition().distance(target);
+            min_error = std::min(min_error, error);
+            max_error = std::max(max_error, error);
+            total_error += error;
+            error_samples++;
+            
+            // Check if waypoint reached and update target
+            size_t previous_index = path_manager.getCurrentIndex();
+            bool path_done = path_manager.updateTarget(uav.getPosition());
+            if (path_manager.getCurrentIndex() != previous_index)
+            {
+                result.waypoints_reached++;
+            }
+            if (path_done)
+            {
+                if (!result.completed)
+                {
+                    result.completed = true;
+                    result.settling_time = simulation_time + step.dt();
+                }
+                uav.resetControllers();  // Reset PID controllers for new waypoint
+                if (verbose)
+                {
+                    AsyncLog::text("\n>>> Path completed! Restarting...\n");
+                    path_manager.reset();
+                }
+            }
+            
+            // Display status periodically
+            if (verbose && display_counter % display_interval == 0)
+            {
+                displayStatus(target, control_force);
+            }
+            
+            simulation_time += step.dt();
+            display_counter++;
+        }
+        
+        result.min_error = min_error;
+        result.max_error = max_error;
+        result.avg_error = (error_samples > 0) ? total_error / error_samples : 0.0;
+        result.final_position = uav.getPosition();
+        
+        if (verbose)
+        {
+            AsyncLog::flush();
+            std::cout << "\n=== Simulation Statistics ===\n";
+            std::cout << "Minimum error: " << std::fixed << std::setprecision(3) << min_error << " m\n";
+            std::cout << "Maximum error: " << std::fixed << std::setprecision(3) << max_error << " m\n";
+            std::cout << "Average error: " << std::fixed << std::setprecision(3) 
+                      << result.avg_error << " m\n";
+            std::cout << "Final position: (" << uav.getPosition().x << ", " 
+                      << uav.getPosition().y << ", " << uav.getPosition().z << ")\n";
+        }
+        return result;
+    }
+    
+    // Status line, formatted later on the logger thread
+    void displayStatus(const Vec3& target, const Vec3& control_force)
+    {
+        const Vec3& pos = uav.getPosition();
+        double error = pos.distance(target);
+        
+        AsyncLog::text("T:{5.2}s | WP:{}/{} | Pos:({5.2},{5.2},{5.2}) | Tgt:({5.2},{5.2},{5.2}) | "
+                       "Err:{5.2}m | Vel:{5.2}m/s | F:({5.2},{5.2},{5.2})",
+                       simulation_time, path_manager.getCurrentIndex() + 1, path_manager.getWaypointCount(),
+                       pos.x, pos.y, pos.z, target.x, target.y, target.z,
+                       error, uav.getVelocity().magnitude(),
+                       control_force.x, control_force.y, control_force.z);
+    }
+};
+
+} // namespace pidsim
+
+#endif
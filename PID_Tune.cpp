@@ -0,0 +1,281 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Batch gain tuner for the PID_Sim cascade controller. Samples gain
+sets (random multipliers around the defaults, or a grid sweep), runs a silent
+Simulation for each on every core and ranks them by tracking error and settling
+time.
+
+Usage: pid_tune [--samples N] [--grid LEVELS] [--seed S] [--duration S]
+                [--path simple|full] [--top K] [--threads T]
+*/
+
+#include "PID_Sim.h"
+#include "WorkerPool.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+using namespace pidsim;
+
+// gain multipliers are sampled in [1/GAIN_RANGE, GAIN_RANGE] (log-uniform)
+static const double GAIN_RANGE = 4.0;
+
+// ranking weights: cost = avg error + MAX_ERROR_WEIGHT * max error
+//                         + SETTLING_WEIGHT * settling time (+ penalty if never completed)
+static const double MAX_ERROR_WEIGHT = 0.1;
+static const double SETTLING_WEIGHT = 0.05;
+static const double INCOMPLETE_PENALTY = 100.0;
+
+// simulations handed to a worker at a time
+static const size_t SAMPLE_GRAIN = 8;
+
+struct TuneOptions
+{
+    size_t samples;
+    int gridLevels;     // > 0 selects the grid sweep
+    unsigned seed;
+    double duration;
+    bool fullPath;
+    size_t top;
+    unsigned threads;
+
+    TuneOptions() : samples(2000), gridLevels(0), seed(1), duration(30.0), fullPath(false), top(10), threads(0) {}
+};
+
+// one evaluated gain set
+struct TuneCandidate
+{
+    CascadeGains gains;
+    SimulationResult result;
+    double cost;
+};
+
+static void printUsage()
+{
+    std::cout << "Usage: pid_tune [--samples N] [--grid LEVELS] [--seed S] [--duration S]\n"
+                 "                [--path simple|full] [--top K] [--threads T]\n";
+}
+
+static bool parseOptions(int argc, char** argv, TuneOptions& opts)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--samples" && hasValue)
+        {
+            opts.samples = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--grid" && hasValue)
+        {
+            opts.gridLevels = std::atoi(argv[++i]);
+        }
+        else if (arg == "--seed" && hasValue)
+        {
+            opts.seed = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--duration" && hasValue)
+        {
+            opts.duration = std::strtod(argv[++i], nullptr);
+        }
+        else if (arg == "--path" && hasValue)
+        {
+            std::string path = argv[++i];
+            if (path != "simple" && path != "full")
+            {
+                return false;
+            }
+            opts.fullPath = (path == "full");
+        }
+        else if (arg == "--top" && hasValue)
+        {
+            opts.top = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--threads" && hasValue)
+        {
+            opts.threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return opts.duration > 0.0 && (opts.gridLevels > 0 || opts.samples > 0);
+}
+
+static PIDGains scaleGains(const PIDGains& g, double p, double i, double d)
+{
+    PIDGains scaled = { g.kp * p, g.ki * i, g.kd * d };
+    return scaled;
+}
+
+// defaults with the position loop scaled by pos[] and the velocity loop by vel[]
+// (kp, ki, kd multipliers, applied to both the X/Y and the Z controllers)
+static CascadeGains scaledDefaults(const double pos[3], const double vel[3])
+{
+    CascadeGains d = CascadeGains::defaults();
+    CascadeGains g;
+    g.pos_xy = scaleGains(d.pos_xy, pos[0], pos[1], pos[2]);
+    g.pos_z  = scaleGains(d.pos_z, pos[0], pos[1], pos[2]);
+    g.vel_xy = scaleGains(d.vel_xy, vel[0], vel[1], vel[2]);
+    g.vel_z  = scaleGains(d.vel_z, vel[0], vel[1], vel[2]);
+    return g;
+}
+
+// every X/Y and Z gain drawn independently, log-uniform around its default
+static void sampleRandom(const TuneOptions& opts, std::vector<TuneCandidate>& out)
+{
+    std::mt19937 rng(opts.seed);
+    std::uniform_real_distribution<double> exponent(-1.0, 1.0);
+    CascadeGains d = CascadeGains::defaults();
+    PIDGains* defaults[4] = { &d.pos_xy, &d.pos_z, &d.vel_xy, &d.vel_z };
+
+    out.resize(opts.samples);
+    out[0].gains = d; // always rank the defaults as a reference
+    for (size_t s = 1; s < out.size(); ++s)
+    {
+        CascadeGains& g = out[s].gains;
+        PIDGains* loops[4] = { &g.pos_xy, &g.pos_z, &g.vel_xy, &g.vel_z };
+        for (int k = 0; k < 4; ++k)
+        {
+            double p = std::pow(GAIN_RANGE, exponent(rng));
+            double i = std::pow(GAIN_RANGE, exponent(rng));
+            double dd = std::pow(GAIN_RANGE, exponent(rng));
+            *loops[k] = scaleGains(*defaults[k], p, i, dd);
+        }
+    }
+}
+
+// levels^6 sweep over the kp/ki/kd multipliers of both loops
+static void sampleGrid(const TuneOptions& opts, std::vector<TuneCandidate>& out)
+{
+    const int levels = opts.gridLevels;
+    std::vector<double> factor(levels);
+    for (int l = 0; l < levels; ++l)
+    {
+        // log-spaced over [1/GAIN_RANGE, GAIN_RANGE], just 1 for a single level
+        double t = (levels > 1) ? 2.0 * l / (levels - 1) - 1.0 : 0.0;
+        factor[l] = std::pow(GAIN_RANGE, t);
+    }
+
+    size_t total = 1;
+    for (int k = 0; k < 6; ++k)
+    {
+        total *= levels;
+    }
+
+    out.resize(total);
+    for (size_t s = 0; s < total; ++s)
+    {
+        double m[6];
+        size_t rest = s;
+        for (int k = 0; k < 6; ++k)
+        {
+            m[k] = factor[rest % levels];
+            rest /= levels;
+        }
+        out[s].gains = scaledDefaults(m, m + 3);
+    }
+}
+
+// lower is better, diverged runs rank last
+static double costOf(const SimulationResult& r)
+{
+    double cost = r.avg_error + MAX_ERROR_WEIGHT * r.max_error + SETTLING_WEIGHT * r.settling_time;
+    if (!r.completed)
+    {
+        cost += INCOMPLETE_PENALTY;
+    }
+    return std::isfinite(cost) ? cost : 1e30;
+}
+
+static void printGains(const char* name, const PIDGains& g)
+{
+    std::cout << "  " << name << " Kp " << std::setw(7) << g.kp << "  Ki " << std::setw(7) << g.ki
+              << "  Kd " << std::setw(7) << g.kd << "\n";
+}
+
+int main(int argc, char** argv)
+{
+    TuneOptions opts;
+    if (!parseOptions(argc, argv, opts))
+    {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<TuneCandidate> candidates;
+    if (opts.gridLevels > 0)
+    {
+        sampleGrid(opts, candidates);
+    }
+    else
+    {
+        sampleRandom(opts, candidates);
+    }
+
+    WorkerPool pool(opts.threads);
+    std::cout << "=== Cascade PID Gain Tuning ===\n";
+    std::cout << "Gain sets: " << candidates.size() << (opts.gridLevels > 0 ? " (grid)" : " (random)")
+              << ", path: " << (opts.fullPath ? "full" : "simple") << ", duration: " << opts.duration
+              << " s, workers: " << pool.size() << "\n\n";
+
+    // every simulation is independent, results land in their own slot
+    const TuneOptions& o = opts;
+    std::vector<TuneCandidate>& c = candidates;
+    auto start = std::chrono::steady_clock::now();
+    pool.parallelFor(candidates.size(), SAMPLE_GRAIN, [&o, &c](size_t begin, size_t end, unsigned)
+    {
+        for (size_t s = begin; s < end; ++s)
+        {
+            Simulation sim(0.01, false, true);
+            if (o.fullPath)
+            {
+                sim.setupPath();
+            }
+            else
+            {
+                sim.setupSimplePath();
+            }
+            sim.setGains(c[s].gains);
+            c[s].result = sim.run(o.duration);
+            c[s].cost = costOf(c[s].result);
+        }
+    });
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // stable so equal costs keep sampling order (reproducible output)
+    std::stable_sort(candidates.begin(), candidates.end(), [](const TuneCandidate& a, const TuneCandidate& b)
+    {
+        return a.cost < b.cost;
+    });
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Evaluated in " << wall << " s (" << (candidates.size() / wall) << " simulations/s)\n\n";
+
+    size_t shown = std::min(opts.top, candidates.size());
+    for (size_t r = 0; r < shown; ++r)
+    {
+        const TuneCandidate& t = candidates[r];
+        std::cout << "#" << (r + 1) << "  cost " << t.cost
+                  << "  avg " << t.result.avg_error << " m  max " << t.result.max_error
+                  << " m  min " << t.result.min_error << " m  settling "
+                  << (t.result.completed ? t.result.settling_time : -1.0) << " s  waypoints "
+                  << t.result.waypoints_reached << "\n";
+        printGains("pos xy", t.gains.pos_xy);
+        printGains("pos z ", t.gains.pos_z);
+        printGains("vel xy", t.gains.vel_xy);
+        printGains("vel z ", t.gains.vel_z);
+    }
+
+    return 0;
+}
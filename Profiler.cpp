@@ -0,0 +1,164 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the frame/tick profiler
+*/
+
+#include "Profiler.h"
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <map>
+#include <algorithm>
+#include <cstdio>
+
+// ring buffer written only by its owning thread
+struct ThreadRing
+{
+    unsigned tid;
+    std::atomic<uint64_t> head; // total events ever written
+    ProfileEvent events[Profiler::RING_SIZE];
+
+    explicit ThreadRing(unsigned id) : tid(id), head(0) {}
+};
+
+static std::atomic<bool> profilerEnabled(true);
+
+// registry of every thread's ring, locked only when a thread records its
+// first event and when reports are generated
+static std::mutex ringsMutex;
+static std::vector<ThreadRing*> rings;
+
+static thread_local ThreadRing* threadRing = nullptr;
+
+static const std::chrono::steady_clock::time_point profilerEpoch = std::chrono::steady_clock::now();
+
+void Profiler::setEnabled(bool enabled)
+{
+    profilerEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Profiler::isEnabled()
+{
+    return profilerEnabled.load(std::memory_order_relaxed);
+}
+
+uint64_t Profiler::now()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - profilerEpoch).count());
+}
+
+void Profiler::record(const char* name, uint64_t start, uint64_t duration)
+{
+    ThreadRing* ring = threadRing;
+    if (!ring)
+    {
+        // first event on this thread; rings are never freed so dumps still see
+        // threads that have exited
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        ring = new ThreadRing(static_cast<unsigned>(rings.size()));
+        rings.push_back(ring);
+        threadRing = ring;
+    }
+
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    ProfileEvent& e = ring->events[head % RING_SIZE];
+    e.name = name;
+    e.start = start;
+    e.duration = duration;
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+// copy out the events of one ring that were not overwritten while copying
+static void copyRing(const ThreadRing& ring, std::vector<ProfileEvent>& out)
+{
+    uint64_t before = ring.head.load(std::memory_order_acquire);
+    uint64_t first = (before > Profiler::RING_SIZE) ? before - Profiler::RING_SIZE : 0;
+
+    std::vector<ProfileEvent> copy;
+    copy.reserve(static_cast<size_t>(before - first));
+    for (uint64_t i = first; i < before; ++i)
+    {
+        copy.push_back(ring.events[i % Profiler::RING_SIZE]);
+    }
+
+    // the writer may have lapped the oldest entries meanwhile, drop those
+    uint64_t after = ring.head.load(std::memory_order_acquire);
+    uint64_t valid = (after > Profiler::RING_SIZE) ? after - Profiler::RING_SIZE : 0;
+    size_t skip = (valid > first) ? static_cast<size_t>(std::min(valid - first, before - first)) : 0;
+
+    out.insert(out.end(), copy.begin() + skip, copy.end());
+}
+
+void Profiler::summarize(std::vector<PhaseStats>& out)
+{
+    std::map<std::string, std::vector<uint64_t> > durations;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        std::vector<ProfileEvent> events;
+        for (const ThreadRing* ring : rings)
+        {
+            events.clear();
+            copyRing(*ring, events);
+            for (const auto& e : events)
+            {
+                durations[e.name].push_back(e.duration);
+            }
+        }
+    }
+
+    out.clear();
+    for (auto& entry : durations)
+    {
+        std::vector<uint64_t>& d = entry.second;
+        std::sort(d.begin(), d.end());
+
+        uint64_t total = 0;
+        for (uint64_t v : d)
+        {
+            total += v;
+        }
+
+        PhaseStats stats;
+        stats.name = entry.first;
+        stats.count = d.size();
+        stats.minMs = d.front() * 1e-6;
+        stats.maxMs = d.back() * 1e-6;
+        stats.avgMs = (static_cast<double>(total) / d.size()) * 1e-6;
+        stats.p99Ms = d[std::min(d.size() - 1, (d.size() * 99) / 100)] * 1e-6;
+        out.push_back(stats);
+    }
+}
+
+bool Profiler::writeChromeTrace(const std::string& path)
+{
+    FILE* f = std::fopen(path.c_str(), "w");
+    if (!f)
+    {
+        return false;
+    }
+
+    std::fprintf(f, "{\"traceEvents\":[\n");
+    bool first = true;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        std::vector<ProfileEvent> events;
+        for (const ThreadRing* ring : rings)
+        {
+            events.clear();
+            copyRing(*ring, events);
+            for (const auto& e : events)
+            {
+                // complete events, timestamps in microseconds
+                std::fprintf(f, "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                             first ? "" : ",\n", e.name, e.start * 1e-3, e.duration * 1e-3, ring->tid);
+                first = false;
+            }
+        }
+    }
+    std::fprintf(f, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    return std::fclose(f) == 0;
+}
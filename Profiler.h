@@ -0,0 +1,90 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the lightweight frame/tick profiler. Scoped timers write
+into a ring buffer owned by the recording thread (no locks on record), summaries
+give per-phase min/avg/p99, and the raw events can be dumped as a Chrome trace
+(chrome://tracing or ui.perfetto.dev).
+*/
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// one timed interval, name must be a string literal (stored by pointer)
+struct ProfileEvent
+{
+    const char* name;
+    uint64_t start;    // ns since profiler start
+    uint64_t duration; // ns
+};
+
+// per-phase statistics over the events currently held in the ring buffers
+struct PhaseStats
+{
+    std::string name;
+    size_t count;
+    double minMs;
+    double avgMs;
+    double p99Ms;
+    double maxMs;
+};
+
+class Profiler
+{
+public:
+    // events kept per thread (older ones are overwritten)
+    static const size_t RING_SIZE = 8192;
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    // ns since the profiler was first used
+    static uint64_t now();
+
+    // append an event to the calling thread's ring buffer
+    static void record(const char* name, uint64_t start, uint64_t duration);
+
+    // stats per phase name, sorted by name
+    static void summarize(std::vector<PhaseStats>& out);
+
+    // write every buffered event as Chrome trace JSON
+    static bool writeChromeTrace(const std::string& path);
+};
+
+// times its own lifetime
+class ProfileScope
+{
+public:
+    explicit ProfileScope(const char* name)
+        : name(name), start(Profiler::isEnabled() ? Profiler::now() : 0), active(Profiler::isEnabled()) {}
+
+    ~ProfileScope()
+    {
+        if (active)
+        {
+            Profiler::record(name, start, Profiler::now() - start);
+        }
+    }
+
+private:
+    ProfileScope(const ProfileScope&);
+    ProfileScope& operator=(const ProfileScope&);
+
+    const char* name;
+    uint64_t start;
+    bool active;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+// PROFILE_SCOPE("collisions"); times the rest of the enclosing block
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+
+#endif
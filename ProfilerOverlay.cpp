@@ -0,0 +1,112 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: On-screen profiler overlay
+*/
+
+#include "ProfilerOverlay.h"
+#include "Profiler.h"
+#include <GL/glut.h>
+#include <vector>
+#include <string>
+#include <cstdio>
+
+// seconds between statistics refreshes
+static const double REFRESH_SECONDS = 0.5;
+
+static const int LINE_HEIGHT = 14;
+static const int MARGIN = 8;
+
+static std::vector<std::string> overlayLines;
+static uint64_t lastRefresh = 0;
+static unsigned long long lastTickCount = 0;
+
+// rebuild the text lines from the current ring buffer contents
+static void refreshLines(unsigned long long tickCount, uint64_t now)
+{
+    double elapsed = (now - lastRefresh) * 1e-9;
+    double ticksPerSecond = (lastRefresh > 0 && elapsed > 0.0) ? (tickCount - lastTickCount) / elapsed : 0.0;
+    lastRefresh = now;
+    lastTickCount = tickCount;
+
+    std::vector<PhaseStats> stats;
+    Profiler::summarize(stats);
+
+    char line[128];
+    overlayLines.clear();
+
+    std::snprintf(line, sizeof(line), "ticks/s %.1f", ticksPerSecond);
+    overlayLines.push_back(line);
+
+    for (const auto& s : stats)
+    {
+        if (s.name == "frame")
+        {
+            std::snprintf(line, sizeof(line), "frame %.2f ms (%.1f fps)", s.avgMs, s.avgMs > 0.0 ? 1000.0 / s.avgMs : 0.0);
+            overlayLines.push_back(line);
+        }
+    }
+
+    overlayLines.push_back("phase              min     avg     p99  (ms)");
+    for (const auto& s : stats)
+    {
+        std::snprintf(line, sizeof(line), "%-16s %7.3f %7.3f %7.3f", s.name.c_str(), s.minMs, s.avgMs, s.p99Ms);
+        overlayLines.push_back(line);
+    }
+}
+
+void drawProfilerOverlay(unsigned long long tickCount, const std::string& status)
+{
+    uint64_t now = Profiler::now();
+    if (overlayLines.empty() || (now - lastRefresh) * 1e-9 >= REFRESH_SECONDS)
+    {
+        refreshLines(tickCount, now);
+    }
+
+    int width = glutGet(GLUT_WINDOW_WIDTH);
+    int height = glutGet(GLUT_WINDOW_HEIGHT);
+
+    // pixel coordinates, origin top-left
+    glPushAttrib(GL_ENABLE_BIT | GL_CURRENT_BIT);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_LIGHTING);
+
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    glOrtho(0.0, width, height, 0.0, -1.0, 1.0);
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+
+    glColor3f(1.0f, 1.0f, 1.0f);
+    int y = MARGIN + LINE_HEIGHT;
+    for (size_t line = 0; line < overlayLines.size(); ++line)
+    {
+        glRasterPos2i(MARGIN, y);
+        for (char c : overlayLines[line])
+        {
+            glutBitmapCharacter(GLUT_BITMAP_8_BY_13, c);
+        }
+        y += LINE_HEIGHT;
+
+        // status goes after the ticks/s line
+        if (line == 0 && !status.empty())
+        {
+            glRasterPos2i(MARGIN, y);
+            for (char c : status)
+            {
+                glutBitmapCharacter(GLUT_BITMAP_8_BY_13, c);
+            }
+            y += LINE_HEIGHT;
+        }
+    }
+
+    glPopMatrix();
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPopAttrib();
+}
@@ -0,0 +1,20 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the on-screen profiler overlay (per-phase timings,
+ticks per second and frame time drawn as GLUT bitmap text)
+*/
+
+#ifndef PROFILER_OVERLAY_H
+#define PROFILER_OVERLAY_H
+
+#include <string>
+
+// draw the overlay in the top-left corner of the window; tickCount is the
+// scheduler's tick counter, used for the ticks-per-second readout. Statistics
+// are refreshed a few times a second, not every frame; status (e.g. what was
+// drawn this frame) is shown under the rates as given
+void drawProfilerOverlay(unsigned long long tickCount, const std::string& status = std::string());
+
+#endif
@@ -0,0 +1,330 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the scenario loader and formation generators
+*/
+
+#include "Scenario.h"
+#include "ECE_UAV.h"
+#include "MappedFile.h"
+#include "FastParse.h"
+#include <iostream>
+#include <random>
+#include <cmath>
+#include <cstring>
+
+static const float PI = 3.14159265f;
+
+Scenario::Scenario()
+    : uavCount(15), formation(FORMATION_FIELD), spacing(2.0f), columns(0), ringRadius(50.0f), seed(1), formationGroup(0)
+{
+    origin[0] = origin[1] = origin[2] = 0.0f;
+    boxSize[0] = boxSize[1] = 100.0f;
+    boxSize[2] = 20.0f;
+}
+
+const char* formationName(FormationType formation)
+{
+    static const char* names[] = { "field", "grid", "ring", "random" };
+    return names[formation];
+}
+
+// allowed range of a float key's values
+enum FloatRange
+{
+    ANY_VALUE,
+    POSITIVE,    // > 0
+    NON_NEGATIVE // >= 0
+};
+
+// keys holding a fixed number of floats
+struct FloatKey
+{
+    const char* name;
+    FloatRange range;
+    int count;
+    float* values[3];
+};
+
+// true if value lies in range
+static bool inRange(float value, FloatRange range)
+{
+    switch (range)
+    {
+    case POSITIVE:
+        return value > 0.0f;
+    case NON_NEGATIVE:
+        return value >= 0.0f;
+    default:
+        return true;
+    }
+}
+
+// true if [p, end) is exactly text
+static bool matches(const char* p, const char* end, const char* text)
+{
+    size_t length = std::strlen(text);
+    return static_cast<size_t>(end - p) == length && std::memcmp(p, text, length) == 0;
+}
+
+// value text without trailing spaces or comment
+static const char* valueEnd(const char* p, const char* end)
+{
+    const char* stop = p;
+    while (stop < end && *stop != '\n' && *stop != '#')
+    {
+        ++stop;
+    }
+    while (stop > p && (stop[-1] == ' ' || stop[-1] == '\t' || stop[-1] == '\r'))
+    {
+        --stop;
+    }
+    return stop;
+}
+
+// missions path relative to the scenario file's directory
+static std::string besideFile(const std::string& file, const std::string& path)
+{
+    size_t slash = file.find_last_of("/\\");
+    if (path.empty() || path[0] == '/' || slash == std::string::npos)
+    {
+        return path;
+    }
+    return file.substr(0, slash + 1) + path;
+}
+
+bool loadScenario(const std::string& path, Scenario& s)
+{
+    MappedFile file;
+    if (!file.open(path))
+    {
+        std::cerr << "Could not open scenario " << path << "\n";
+        return false;
+    }
+
+    SwarmParams& p = s.params;
+    const FloatKey floatKeys[] =
+    {
+        { "formation.origin", ANY_VALUE, 3, { &s.origin[0], &s.origin[1], &s.origin[2] } },
+        { "formation.spacing", ANY_VALUE, 1, { &s.spacing } },
+        { "formation.radius", ANY_VALUE, 1, { &s.ringRadius } },
+        { "formation.size", ANY_VALUE, 3, { &s.boxSize[0], &s.boxSize[1], &s.boxSize[2] } },
+        { "physics.dt", POSITIVE, 1, { &p.dt } },
+        { "physics.gravity", ANY_VALUE, 1, { &p.gravity } },
+        { "physics.mass", POSITIVE, 1, { &p.mass } },
+        { "physics.max_force", POSITIVE, 1, { &p.maxForcePerAxis } },
+        { "physics.drag", NON_NEGATIVE, 1, { &p.dragCoeff } },
+        { "physics.collision_distance", POSITIVE, 1, { &p.collisionDistance } },
+        { "physics.tolerance", POSITIVE, 1, { &p.tolerance } },
+        { "target.center", ANY_VALUE, 3, { &p.centerX, &p.centerY, &p.centerZ } },
+        { "target.radius", NON_NEGATIVE, 1, { &p.radius } },
+        { "gains.x", NON_NEGATIVE, 3, { &p.kpX, &p.kiX, &p.kdX } },
+        { "gains.y", NON_NEGATIVE, 3, { &p.kpY, &p.kiY, &p.kdY } },
+        { "gains.z", NON_NEGATIVE, 3, { &p.kpZ, &p.kiZ, &p.kdZ } },
+        { "flock.radius", NON_NEGATIVE, 1, { &s.flock.radius } },
+        { "flock.separation", ANY_VALUE, 1, { &s.flock.separation } },
+        { "flock.alignment", ANY_VALUE, 1, { &s.flock.alignment } },
+        { "flock.cohesion", ANY_VALUE, 1, { &s.flock.cohesion } },
+        { "flock.max_offset", NON_NEGATIVE, 1, { &s.flock.maxOffset } },
+    };
+    const size_t numFloatKeys = sizeof(floatKeys) / sizeof(floatKeys[0]);
+
+    const char* c = file.data();
+    const char* end = c + file.size();
+    size_t line = 0;
+
+    while (c < end)
+    {
+        ++line;
+        skipSpaces(c, end);
+        if (c >= end || *c == '\n' || *c == '#')
+        {
+            skipLine(c, end);
+            continue;
+        }
+
+        // key = value
+        const char* key = c;
+        while (c < end && *c != '=' && *c != ' ' && *c != '\t' && *c != '\n')
+        {
+            ++c;
+        }
+        const char* keyEnd = c;
+        skipSpaces(c, end);
+        if (c >= end || *c != '=')
+        {
+            std::cerr << path << ":" << line << ": expected key = value\n";
+            return false;
+        }
+        ++c;
+        skipSpaces(c, end);
+        const char* value = c;
+        const char* stop = valueEnd(value, end);
+
+        bool ok = true;
+        bool known = true;
+        const char* requirement = nullptr; // range the value broke, if any
+        long number = 0;
+        if (matches(key, keyEnd, "uavs") || matches(key, keyEnd, "formation.columns")
+            || matches(key, keyEnd, "formation.seed") || matches(key, keyEnd, "formation.group")
+            || matches(key, keyEnd, "flock.neighbours"))
+        {
+            ok = parseInt(c, stop, number) && c == stop && number >= 0;
+            if (matches(key, keyEnd, "uavs"))
+            {
+                s.uavCount = static_cast<size_t>(number);
+            }
+            else if (matches(key, keyEnd, "formation.columns"))
+            {
+                s.columns = static_cast<size_t>(number);
+            }
+            else if (matches(key, keyEnd, "formation.seed"))
+            {
+                s.seed = static_cast<unsigned>(number);
+            }
+            else if (matches(key, keyEnd, "formation.group"))
+            {
+                s.formationGroup = static_cast<size_t>(number);
+            }
+            else
+            {
+                s.flock.neighbours = static_cast<unsigned>(number);
+            }
+        }
+        else if (matches(key, keyEnd, "formation"))
+        {
+            ok = false;
+            for (int f = FORMATION_FIELD; f <= FORMATION_RANDOM; ++f)
+            {
+                if (matches(value, stop, formationName(static_cast<FormationType>(f))))
+                {
+                    s.formation = static_cast<FormationType>(f);
+                    ok = true;
+                }
+            }
+        }
+        else if (matches(key, keyEnd, "physics.integrator"))
+        {
+            ok = false;
+            for (int m = 0; m < NUM_INTEGRATORS; ++m)
+            {
+                if (matches(value, stop, integratorName(m)))
+                {
+                    p.integrator = m;
+                    ok = true;
+                }
+            }
+        }
+        else if (matches(key, keyEnd, "missions"))
+        {
+            s.missionPath = besideFile(path, std::string(value, stop));
+        }
+        else
+        {
+            known = false;
+            for (size_t k = 0; k < numFloatKeys && !known; ++k)
+            {
+                const FloatKey& fk = floatKeys[k];
+                if (!matches(key, keyEnd, fk.name))
+                {
+                    continue;
+                }
+                known = true;
+                for (int v = 0; v < fk.count && ok; ++v)
+                {
+                    skipSpaces(c, stop);
+                    ok = parseFloat(c, stop, *fk.values[v]);
+                    if (ok && !inRange(*fk.values[v], fk.range))
+                    {
+                        requirement = (fk.range == POSITIVE) ? "positive" : "zero or more";
+                    }
+                }
+                skipSpaces(c, stop);
+                ok = ok && c == stop;
+            }
+        }
+
+        if (!known)
+        {
+            std::cerr << path << ":" << line << ": unknown key " << std::string(key, keyEnd) << "\n";
+            return false;
+        }
+        if (!ok)
+        {
+            std::cerr << path << ":" << line << ": bad value for " << std::string(key, keyEnd) << "\n";
+            return false;
+        }
+        if (requirement)
+        {
+            std::cerr << path << ":" << line << ": " << std::string(key, keyEnd) << " must be " << requirement << "\n";
+            return false;
+        }
+        skipLine(c, end);
+    }
+    return true;
+}
+
+FormationStream::FormationStream(const Scenario& scenario)
+    : s(scenario), index(0), columns(scenario.columns), rng(scenario.seed), unit(0.0f, 1.0f)
+{
+    if (columns == 0)
+    {
+        columns = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(s.uavCount))));
+    }
+}
+
+void FormationStream::next(float& x, float& y, float& z)
+{
+    const size_t i = index++;
+    x = s.origin[0];
+    y = s.origin[1];
+    z = s.origin[2];
+    switch (s.formation)
+    {
+    case FORMATION_FIELD:
+    {
+        float fx, fy;
+        fieldFormationPosition(i, s.uavCount, fx, fy);
+        x += fx;
+        y += fy;
+        break;
+    }
+
+    case FORMATION_GRID:
+        x += (i % columns) * s.spacing;
+        y += (i / columns) * s.spacing;
+        break;
+
+    case FORMATION_RING:
+    {
+        float angle = 2.0f * PI * i / s.uavCount;
+        x += s.ringRadius * std::cos(angle);
+        y += s.ringRadius * std::sin(angle);
+        break;
+    }
+
+    case FORMATION_RANDOM:
+        // drawn in x, y, z order, so each UAV's position depends on the ones before
+        x += unit(rng) * s.boxSize[0];
+        y += unit(rng) * s.boxSize[1];
+        z += unit(rng) * s.boxSize[2];
+        break;
+    }
+}
+
+void buildSwarm(const Scenario& s, SwarmState& swarm)
+{
+    const size_t count = s.uavCount;
+    swarm.clear();
+    swarm.params = s.params;
+    swarm.reserve(count);
+
+    FormationStream formation(s);
+    for (size_t i = 0; i < count; ++i)
+    {
+        float x, y, z;
+        formation.next(x, y, z);
+        swarm.addUAV(x, y, z);
+    }
+}
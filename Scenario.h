@@ -0,0 +1,110 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for scenario files. A scenario sets the swarm size, the
+formation the UAVs start in, and the physics constants and gains, so large runs
+need no recompiling. The file is plain key = value lines ('#' starts a comment,
+lists are space separated):
+
+    uavs = 100000
+    formation = grid              # field, grid, ring or random
+    formation.origin = 0 0 0      # grid corner, ring center, random box corner
+    formation.spacing = 2         # grid
+    formation.columns = 0         # grid, 0 = square
+    formation.radius = 50         # ring
+    formation.size = 100 100 20   # random box extent
+    formation.seed = 1            # random
+    formation.group = 0           # keep shape in groups of N around each group's first UAV, 0 = off
+    physics.dt = 0.01
+    physics.gravity = -10
+    physics.mass = 1
+    physics.max_force = 20
+    physics.drag = 0.05
+    physics.collision_distance = 0.01
+    physics.integrator = euler    # euler, verlet, rk4 or adaptive
+    physics.tolerance = 0.0001    # adaptive, local error per substep (m)
+    target.center = 0 0 50        # default sphere target
+    target.radius = 10
+    gains.x = 4 0.2 2             # kp ki kd
+    gains.y = 4 0.2 2
+    gains.z = 5 0.3 2.5
+    flock.radius = 5              # neighbour radius (m)
+    flock.neighbours = 7          # nearest neighbours considered
+    flock.separation = 0          # flocking weights, see SwarmBehaviours.h
+    flock.alignment = 0
+    flock.cohesion = 0
+    flock.max_offset = 5          # longest target offset from flocking (m)
+    missions = missions.txt       # optional, see MissionEngine.h
+
+Keys left out keep the defaults above (field formation of 15 UAVs, SwarmParams,
+no flocking). dt, mass, max_force, collision_distance and tolerance must be
+positive; drag, gains, target.radius, flock.radius and flock.max_offset must not
+be negative.
+*/
+
+#ifndef SCENARIO_H
+#define SCENARIO_H
+
+#include "SwarmState.h"
+#include "SwarmBehaviours.h"
+#include <string>
+#include <random>
+#include <cstddef>
+
+enum FormationType
+{
+    FORMATION_FIELD,  // grid over the 50 x 100 yard field, see initFieldFormation
+    FORMATION_GRID,
+    FORMATION_RING,
+    FORMATION_RANDOM
+};
+
+struct Scenario
+{
+    size_t uavCount;
+    FormationType formation;
+    float origin[3];
+    float spacing;
+    size_t columns;
+    float ringRadius;
+    float boxSize[3];
+    unsigned seed;
+    size_t formationGroup; // 0 = no formation keeping
+
+    SwarmParams params;
+    FlockParams flock;
+    std::string missionPath; // empty = every UAV orbits the sphere
+
+    Scenario();
+};
+
+// read a scenario file over the defaults, returns false (and reports the line)
+// on an unknown key or a bad value
+bool loadScenario(const std::string& path, Scenario& scenario);
+
+// replace the swarm with the scenario's UAVs, at rest in their formation
+void buildSwarm(const Scenario& scenario, SwarmState& swarm);
+
+// the scenario's starting positions in UAV order, one at a time, so part of a
+// large swarm can be built without holding the rest (see uav_domain)
+class FormationStream
+{
+public:
+    explicit FormationStream(const Scenario& scenario);
+
+    // position of the next UAV
+    void next(float& x, float& y, float& z);
+
+private:
+    const Scenario& s;
+    size_t index;
+    size_t columns; // grid
+    std::mt19937 rng; // random
+    std::uniform_real_distribution<float> unit;
+};
+
+// formation name ("field", "grid", "ring", "random")
+const char* formationName(FormationType formation);
+
+#endif
@@ -0,0 +1,306 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the spatial hash collision broad phase
+*/
+
+#include "SpatialHash.h"
+#include <algorithm>
+#include <climits>
+
+// constructor
+SpatialHash::SpatialHash(float cellSize)
+    : cellSize(cellSize), invCellSize(1.0f / cellSize), mask(0),
+      posX(nullptr), posY(nullptr), posZ(nullptr), count(0)
+{
+}
+
+void SpatialHash::setCellSize(float size)
+{
+    cellSize = size;
+    invCellSize = 1.0f / size;
+}
+
+float SpatialHash::getCellSize() const
+{
+    return cellSize;
+}
+
+// cell coordinates stay within +-CELL_LIMIT so the int cast is defined and
+// neighbour arithmetic like cx + 1 cannot overflow
+static const float CELL_LIMIT = static_cast<float>(INT_MAX / 2);
+
+// floor without the libm call (baseline x86-64 has no roundss). Far positions
+// clamp to the edge cells; NaN fails every comparison and lands in the far
+// positive cell, away from any real UAV
+int SpatialHash::cellCoord(float v) const
+{
+    float scaled = v * invCellSize;
+    if (!(scaled < CELL_LIMIT))
+    {
+        scaled = CELL_LIMIT;
+    }
+    else if (scaled < -CELL_LIMIT)
+    {
+        scaled = -CELL_LIMIT;
+    }
+    int truncated = static_cast<int>(scaled);
+    return truncated - (scaled < static_cast<float>(truncated) ? 1 : 0);
+}
+
+size_t SpatialHash::bucketOfCell(int cx, int cy, int cz) const
+{
+    // large primes spread neighbouring cells over the table
+    uint32_t h = static_cast<uint32_t>(cx) * 73856093u
+               ^ static_cast<uint32_t>(cy) * 19349663u
+               ^ static_cast<uint32_t>(cz) * 83492791u;
+    return h & mask;
+}
+
+size_t SpatialHash::bucketOf(float px, float py, float pz) const
+{
+    return bucketOfCell(cellCoord(px), cellCoord(py), cellCoord(pz));
+}
+
+// counting sort of UAV indices into buckets
+void SpatialHash::build(const float* x, const float* y, const float* z, size_t n)
+{
+    posX = x;
+    posY = y;
+    posZ = z;
+    count = n;
+
+    // about two buckets per UAV keeps hash collisions rare
+    size_t buckets = 64;
+    while (buckets < n * 2)
+    {
+        buckets <<= 1;
+    }
+    mask = buckets - 1;
+
+    bucketStart.assign(buckets + 1, 0);
+    uavBucket.resize(n);
+    sorted.resize(n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        size_t b = bucketOf(x[i], y[i], z[i]);
+        uavBucket[i] = static_cast<uint32_t>(b);
+        ++bucketStart[b + 1];
+    }
+
+    for (size_t b = 0; b < buckets; ++b)
+    {
+        bucketStart[b + 1] += bucketStart[b];
+    }
+
+    // walk UAVs in index order so each bucket stays sorted
+    cursor.assign(bucketStart.begin(), bucketStart.end() - 1);
+    for (size_t i = 0; i < n; ++i)
+    {
+        sorted[cursor[uavBucket[i]]++] = static_cast<uint32_t>(i);
+    }
+}
+
+size_t SpatialHash::bucketCount() const
+{
+    return mask + 1;
+}
+
+const uint32_t* SpatialHash::bucketBegin(size_t bucket) const
+{
+    return sorted.data() + bucketStart[bucket];
+}
+
+const uint32_t* SpatialHash::bucketEnd(size_t bucket) const
+{
+    return sorted.data() + bucketStart[bucket + 1];
+}
+
+// buckets of the cells the query sphere overlaps, deduplicated since two cells
+// can hash to the same bucket. dist <= cellSize reaches one cell either way; the
+// block is also held to the 27 cells around the point so out can never overflow
+size_t SpatialHash::nearbyBuckets(float px, float py, float pz, float dist, size_t* out) const
+{
+    const int cx = cellCoord(px), cy = cellCoord(py), cz = cellCoord(pz);
+    const int x0 = std::max(cellCoord(px - dist), cx - 1), x1 = std::min(cellCoord(px + dist), cx + 1);
+    const int y0 = std::max(cellCoord(py - dist), cy - 1), y1 = std::min(cellCoord(py + dist), cy + 1);
+    const int z0 = std::max(cellCoord(pz - dist), cz - 1), z1 = std::min(cellCoord(pz + dist), cz + 1);
+
+    size_t found = 0;
+    for (int cx = x0; cx <= x1; ++cx)
+    {
+        for (int cy = y0; cy <= y1; ++cy)
+        {
+            for (int cz = z0; cz <= z1; ++cz)
+            {
+                size_t bucket = bucketOfCell(cx, cy, cz);
+                if (bucketStart[bucket] == bucketStart[bucket + 1])
+                {
+                    continue;
+                }
+                if (std::find(out, out + found, bucket) == out + found)
+                {
+                    out[found++] = bucket;
+                }
+            }
+        }
+    }
+    return found;
+}
+
+void SpatialHash::findPairs(size_t firstBucket, size_t lastBucket, float maxDist,
+                            std::vector<ContactPair>& out) const
+{
+    maxDist = std::min(maxDist, cellSize); // the scan reaches one cell around
+    const float maxDistSq = maxDist * maxDist;
+    size_t neighbours[27];
+
+    for (size_t b = firstBucket; b < lastBucket; ++b)
+    {
+        for (uint32_t k = bucketStart[b]; k < bucketStart[b + 1]; ++k)
+        {
+            const uint32_t i = sorted[k];
+            const float px = posX[i];
+            const float py = posY[i];
+            const float pz = posZ[i];
+
+            const size_t numNeighbours = nearbyBuckets(px, py, pz, maxDist, neighbours);
+            for (size_t nb = 0; nb < numNeighbours; ++nb)
+            {
+                const size_t bucket = neighbours[nb];
+                for (uint32_t m = bucketStart[bucket]; m < bucketStart[bucket + 1]; ++m)
+                {
+                    const uint32_t j = sorted[m];
+                    if (j <= i)
+                    {
+                        continue; // each pair once, from its lower index
+                    }
+
+                    float dx = px - posX[j];
+                    float dy = py - posY[j];
+                    float dz = pz - posZ[j];
+                    if (dx * dx + dy * dy + dz * dz < maxDistSq)
+                    {
+                        ContactPair pair = { i, j };
+                        out.push_back(pair);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// the UAV's own cell is scanned first, and once k neighbours are found a
+// neighbouring cell farther away than the k-th is skipped; in a crowd most
+// queries never leave the own cell
+void SpatialHash::findNearest(size_t first, size_t last, float maxDist, unsigned k,
+                              uint32_t* neighbours, uint32_t* counts) const
+{
+    if (k == 0)
+    {
+        std::fill(counts, counts + (last - first), 0u);
+        return;
+    }
+    maxDist = std::min(maxDist, cellSize); // the scan reaches one cell around
+    const float maxDistSq = maxDist * maxDist;
+    std::vector<float> distSq(k);
+
+    for (size_t i = first; i < last; ++i)
+    {
+        const float px = posX[i];
+        const float py = posY[i];
+        const float pz = posZ[i];
+        uint32_t* list = neighbours + (i - first) * k;
+        unsigned found = 0;
+
+        const int cx = cellCoord(px), cy = cellCoord(py), cz = cellCoord(pz);
+        const int x0 = std::max(cellCoord(px - maxDist), cx - 1), x1 = std::min(cellCoord(px + maxDist), cx + 1);
+        const int y0 = std::max(cellCoord(py - maxDist), cy - 1), y1 = std::min(cellCoord(py + maxDist), cy + 1);
+        const int z0 = std::max(cellCoord(pz - maxDist), cz - 1), z1 = std::min(cellCoord(pz + maxDist), cz + 1);
+
+        // gap from the point to a cell along one axis
+        auto gap = [this](float v, int c, int center)
+        {
+            if (c == center)
+            {
+                return 0.0f;
+            }
+            return (c < center) ? v - (c + 1) * cellSize : c * cellSize - v;
+        };
+
+        // visit 0 is the own cell, then every cell of the block except it
+        size_t scanned[27];
+        size_t numScanned = 0;
+        const int spanY = y1 - y0 + 1, spanZ = z1 - z0 + 1;
+        const int numCells = (x1 - x0 + 1) * spanY * spanZ;
+        for (int visit = -1; visit < numCells; ++visit)
+        {
+            int x = cx, y = cy, z = cz;
+            if (visit >= 0)
+            {
+                x = x0 + visit / (spanY * spanZ);
+                y = y0 + visit / spanZ % spanY;
+                z = z0 + visit % spanZ;
+                if (x == cx && y == cy && z == cz)
+                {
+                    continue;
+                }
+                float gx = gap(px, x, cx), gy = gap(py, y, cy), gz = gap(pz, z, cz);
+                float cellDistSq = gx * gx + gy * gy + gz * gz;
+                if (cellDistSq >= maxDistSq || (found == k && cellDistSq > distSq[k - 1]))
+                {
+                    continue;
+                }
+            }
+
+            // two cells can hash to the same bucket
+            const size_t bucket = bucketOfCell(x, y, z);
+            if (bucketStart[bucket] == bucketStart[bucket + 1]
+                || std::find(scanned, scanned + numScanned, bucket) != scanned + numScanned)
+            {
+                continue;
+            }
+            scanned[numScanned++] = bucket;
+
+            for (uint32_t m = bucketStart[bucket]; m < bucketStart[bucket + 1]; ++m)
+            {
+                const uint32_t j = sorted[m];
+                float dx = px - posX[j];
+                float dy = py - posY[j];
+                float dz = pz - posZ[j];
+                float d = dx * dx + dy * dy + dz * dz;
+                if (j == i || d >= maxDistSq)
+                {
+                    continue;
+                }
+
+                // insertion into the short sorted list, after every closer (or
+                // equally close, lower index) entry
+                unsigned at = found;
+                while (at > 0 && (d < distSq[at - 1] || (d == distSq[at - 1] && j < list[at - 1])))
+                {
+                    --at;
+                }
+                if (at >= k)
+                {
+                    continue;
+                }
+                unsigned move = (found < k) ? found : k - 1;
+                for (unsigned s = move; s > at; --s)
+                {
+                    distSq[s] = distSq[s - 1];
+                    list[s] = list[s - 1];
+                }
+                distSq[at] = d;
+                list[at] = j;
+                if (found < k)
+                {
+                    ++found;
+                }
+            }
+        }
+        counts[i - first] = found;
+    }
+}
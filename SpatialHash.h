@@ -0,0 +1,86 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for a uniform-grid spatial hash used as the collision broad phase
+and as the neighbour index of the flocking behaviours. UAVs are counting-sorted into
+hashed cells once per tick; pair and nearest-neighbour queries only look at the cells
+the query distance reaches (at most the 27 around each UAV) and compare squared
+distances, so a query costs the same however large the swarm is.
+*/
+
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// a pair of UAV indices (first < second) closer than the query distance
+struct ContactPair
+{
+    uint32_t first;
+    uint32_t second;
+};
+
+class SpatialHash
+{
+public:
+    // cellSize should be at least the largest query distance
+    explicit SpatialHash(float cellSize = 1.0f);
+
+    void setCellSize(float size);
+    float getCellSize() const;
+
+    // rebuild the grid from position arrays (storage is reused between ticks)
+    void build(const float* x, const float* y, const float* z, size_t count);
+
+    // number of hash buckets, pair queries can be split over bucket ranges
+    size_t bucketCount() const;
+
+    // append every pair with distance < maxDist (clamped to the cell size) whose lower
+    // index lives in buckets [bucketBegin, bucketEnd), safe to call concurrently
+    // on disjoint ranges
+    void findPairs(size_t bucketBegin, size_t bucketEnd, float maxDist,
+                   std::vector<ContactPair>& out) const;
+
+    // for UAVs [first, last): the k nearest other UAVs closer than maxDist
+    // (maxDist is clamped to the cell size), nearest first, ties by index. UAV i's list is
+    // neighbours[(i - first) * k ..] and counts[i - first] long; safe to call
+    // concurrently on disjoint ranges
+    void findNearest(size_t first, size_t last, float maxDist, unsigned k,
+                     uint32_t* neighbours, uint32_t* counts) const;
+
+    // UAV indices stored in one bucket, in ascending index order
+    const uint32_t* bucketBegin(size_t bucket) const;
+    const uint32_t* bucketEnd(size_t bucket) const;
+
+    // bucket holding a point
+    size_t bucketOf(float px, float py, float pz) const;
+
+    // bucket for integer cell coordinates
+    size_t bucketOfCell(int cx, int cy, int cz) const;
+
+    // integer cell coordinate along one axis
+    int cellCoord(float v) const;
+
+private:
+    // non-empty buckets within dist of a point, without duplicates (<= 27)
+    size_t nearbyBuckets(float px, float py, float pz, float dist, size_t* out) const;
+
+    float cellSize;
+    float invCellSize;
+    size_t mask; // bucket count - 1 (power of two)
+
+    const float* posX;
+    const float* posY;
+    const float* posZ;
+    size_t count;
+
+    std::vector<uint32_t> bucketStart; // bucket b holds sorted[bucketStart[b] .. bucketStart[b+1])
+    std::vector<uint32_t> sorted;      // UAV indices grouped by bucket
+    std::vector<uint32_t> uavBucket;   // bucket of each UAV
+    std::vector<uint32_t> cursor;      // scratch fill position per bucket
+};
+
+#endif
@@ -0,0 +1,284 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the flocking and formation-keeping behaviours
+*/
+
+#include "SwarmBehaviours.h"
+#include <cmath>
+
+// constructor
+SwarmBehaviours::SwarmBehaviours(const FlockParams& params) : params(params)
+{
+}
+
+void SwarmBehaviours::captureFormation(const SwarmState& swarm, size_t groupSize)
+{
+    const size_t count = swarm.size();
+    leader.resize(count);
+    slotX.resize(count);
+    slotY.resize(count);
+    slotZ.resize(count);
+    if (groupSize == 0)
+    {
+        groupSize = 1;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const size_t head = i - i % groupSize;
+        leader[i] = static_cast<uint32_t>(head);
+        slotX[i] = swarm.posX[i] - swarm.posX[head];
+        slotY[i] = swarm.posY[i] - swarm.posY[head];
+        slotZ[i] = swarm.posZ[i] - swarm.posZ[head];
+    }
+    linkFormation();
+}
+
+void SwarmBehaviours::clearFormation()
+{
+    leader.clear();
+    slotX.clear();
+    slotY.clear();
+    slotZ.clear();
+    groupNext.clear();
+    groupPrev.clear();
+}
+
+void SwarmBehaviours::linkFormation()
+{
+    const size_t count = leader.size();
+    groupNext.resize(count);
+    groupPrev.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        groupNext[i] = groupPrev[i] = static_cast<uint32_t>(i);
+    }
+
+    // followers join at the back of their leader's list, in index order
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint32_t head = leader[i];
+        if (head == i)
+        {
+            continue;
+        }
+        const uint32_t tail = groupPrev[head];
+        groupNext[tail] = static_cast<uint32_t>(i);
+        groupPrev[i] = tail;
+        groupNext[i] = head;
+        groupPrev[head] = static_cast<uint32_t>(i);
+    }
+}
+
+void SwarmBehaviours::addUAV()
+{
+    if (leader.empty())
+    {
+        return;
+    }
+    const uint32_t index = static_cast<uint32_t>(leader.size());
+    leader.push_back(index);
+    slotX.push_back(0.0f);
+    slotY.push_back(0.0f);
+    slotZ.push_back(0.0f);
+    groupNext.push_back(index);
+    groupPrev.push_back(index);
+}
+
+void SwarmBehaviours::removeUAV(size_t index)
+{
+    if (leader.empty())
+    {
+        return;
+    }
+    const uint32_t gone = static_cast<uint32_t>(index);
+    const uint32_t last = static_cast<uint32_t>(leader.size() - 1);
+
+    // a leaving leader hands the group to the next UAV in it
+    const uint32_t next = groupNext[gone];
+    if (leader[gone] == gone && next != gone)
+    {
+        const float ox = slotX[next], oy = slotY[next], oz = slotZ[next];
+        for (uint32_t j = next; j != gone; j = groupNext[j])
+        {
+            leader[j] = next;
+            slotX[j] -= ox;
+            slotY[j] -= oy;
+            slotZ[j] -= oz;
+        }
+    }
+    groupNext[groupPrev[gone]] = next;
+    groupPrev[next] = groupPrev[gone];
+
+    // the last UAV moves into the freed index, its group follows it there
+    if (last != gone)
+    {
+        leader[gone] = leader[last];
+        slotX[gone] = slotX[last];
+        slotY[gone] = slotY[last];
+        slotZ[gone] = slotZ[last];
+        if (groupNext[last] == last)
+        {
+            groupNext[gone] = groupPrev[gone] = gone;
+        }
+        else
+        {
+            groupNext[gone] = groupNext[last];
+            groupPrev[gone] = groupPrev[last];
+            groupPrev[groupNext[gone]] = gone;
+            groupNext[groupPrev[gone]] = gone;
+        }
+        if (leader[gone] == last)
+        {
+            uint32_t j = gone;
+            do
+            {
+                leader[j] = gone;
+                j = groupNext[j];
+            } while (j != gone);
+        }
+    }
+    leader.pop_back();
+    slotX.pop_back();
+    slotY.pop_back();
+    slotZ.pop_back();
+    groupNext.pop_back();
+    groupPrev.pop_back();
+}
+
+void SwarmBehaviours::reserve(size_t capacity)
+{
+    leader.reserve(capacity);
+    slotX.reserve(capacity);
+    slotY.reserve(capacity);
+    slotZ.reserve(capacity);
+    groupNext.reserve(capacity);
+    groupPrev.reserve(capacity);
+}
+
+bool SwarmBehaviours::isFlocking() const
+{
+    return params.neighbours > 0 && params.radius > 0.0f
+           && (params.separation != 0.0f || params.alignment != 0.0f || params.cohesion != 0.0f);
+}
+
+bool SwarmBehaviours::isActive() const
+{
+    return isFlocking() || !leader.empty();
+}
+
+void SwarmBehaviours::buildIndex(const SwarmState& swarm)
+{
+    const size_t count = swarm.size();
+    nearest.resize(count * params.neighbours);
+    counts.assign(count, 0);
+    goalX.resize(count);
+    goalY.resize(count);
+    goalZ.resize(count);
+
+    if (isFlocking())
+    {
+        index.setCellSize(params.radius);
+        index.build(swarm.posX.data(), swarm.posY.data(), swarm.posZ.data(), count);
+    }
+}
+
+void SwarmBehaviours::steerRange(SwarmState& swarm, size_t begin, size_t end)
+{
+    const FlockParams& p = params;
+    const unsigned k = p.neighbours;
+    const bool flocking = isFlocking();
+    const bool formation = leader.size() == swarm.size();
+    if (flocking)
+    {
+        index.findNearest(begin, end, p.radius, k, nearest.data() + begin * k, counts.data() + begin);
+    }
+
+    const float invRadius = (p.radius > 0.0f) ? 1.0f / p.radius : 0.0f;
+    const float maxOffsetSq = p.maxOffset * p.maxOffset;
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        goalX[i] = swarm.targetX[i];
+        goalY[i] = swarm.targetY[i];
+        goalZ[i] = swarm.targetZ[i];
+
+        // formation slot replaces the follower's own target
+        float tx = goalX[i], ty = goalY[i], tz = goalZ[i];
+        if (formation && leader[i] != i)
+        {
+            const uint32_t head = leader[i];
+            tx = swarm.posX[head] + slotX[i];
+            ty = swarm.posY[head] + slotY[i];
+            tz = swarm.posZ[head] + slotZ[i];
+        }
+
+        const uint32_t found = flocking ? counts[i] : 0;
+        if (found > 0)
+        {
+            const float px = swarm.posX[i], py = swarm.posY[i], pz = swarm.posZ[i];
+            float sepX = 0.0f, sepY = 0.0f, sepZ = 0.0f;
+            float cenX = 0.0f, cenY = 0.0f, cenZ = 0.0f;
+            float velX = 0.0f, velY = 0.0f, velZ = 0.0f;
+
+            const uint32_t* list = nearest.data() + i * k;
+            for (uint32_t n = 0; n < found; ++n)
+            {
+                const uint32_t j = list[n];
+                float dx = px - swarm.posX[j];
+                float dy = py - swarm.posY[j];
+                float dz = pz - swarm.posZ[j];
+                float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+                if (dist > 0.0f)
+                {
+                    // unit vector away from j, full strength when touching, 0 at the radius
+                    float push = (1.0f - dist * invRadius) / dist;
+                    sepX += dx * push;
+                    sepY += dy * push;
+                    sepZ += dz * push;
+                }
+                cenX += swarm.posX[j];
+                cenY += swarm.posY[j];
+                cenZ += swarm.posZ[j];
+                velX += swarm.velX[j];
+                velY += swarm.velY[j];
+                velZ += swarm.velZ[j];
+            }
+
+            const float inv = 1.0f / found;
+            float ox = p.separation * sepX + p.cohesion * (cenX * inv - px) + p.alignment * (velX * inv - swarm.velX[i]);
+            float oy = p.separation * sepY + p.cohesion * (cenY * inv - py) + p.alignment * (velY * inv - swarm.velY[i]);
+            float oz = p.separation * sepZ + p.cohesion * (cenZ * inv - pz) + p.alignment * (velZ * inv - swarm.velZ[i]);
+
+            float lengthSq = ox * ox + oy * oy + oz * oz;
+            if (lengthSq > maxOffsetSq)
+            {
+                float scale = p.maxOffset / std::sqrt(lengthSq);
+                ox *= scale;
+                oy *= scale;
+                oz *= scale;
+            }
+            tx += ox;
+            ty += oy;
+            tz += oz;
+        }
+
+        swarm.targetX[i] = tx;
+        swarm.targetY[i] = ty;
+        swarm.targetZ[i] = tz;
+    }
+}
+
+// missions hold a waypoint in the target arrays between ticks, so the steered
+// targets must not outlive the integration they were made for
+void SwarmBehaviours::restoreRange(SwarmState& swarm, size_t begin, size_t end) const
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        swarm.targetX[i] = goalX[i];
+        swarm.targetY[i] = goalY[i];
+        swarm.targetZ[i] = goalZ[i];
+    }
+}
@@ -0,0 +1,95 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the swarm's neighbour-aware behaviours: flocking
+(separation, alignment, cohesion) and formation keeping. They do not apply
+forces of their own; each tick they move the position the PID controller steers
+toward, starting from the target the sphere or mission pass produced. Neighbours
+come from one spatial hash rebuilt per tick and queried in batch (k nearest
+within a radius), so the cost per UAV stays flat as the swarm grows. Each
+formation group is also a circular list of its UAVs, so when UAVs are added or
+swap-removed (see SwarmPool) only the group involved is fixed up.
+*/
+
+#ifndef SWARM_BEHAVIOURS_H
+#define SWARM_BEHAVIOURS_H
+
+#include "SwarmState.h"
+#include "SpatialHash.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// flocking weights, all zero = flocking off
+struct FlockParams
+{
+    float radius;        // neighbours farther than this are ignored (m)
+    unsigned neighbours; // nearest neighbours each UAV reacts to
+    float separation;    // target offset away from a neighbour touching this UAV (m)
+    float alignment;     // seconds of the neighbours' mean relative velocity
+    float cohesion;      // fraction of the way to the neighbours' centroid
+    float maxOffset;     // longest offset the three terms may add to the target (m)
+
+    FlockParams()
+        : radius(5.0f), neighbours(7), separation(0.0f), alignment(0.0f), cohesion(0.0f), maxOffset(5.0f) {}
+};
+
+class SwarmBehaviours
+{
+public:
+    FlockParams params;
+
+    // formation slots: UAV i targets leader[i]'s position plus slot offset i;
+    // leaders (leader[i] == i) keep the sphere or mission target
+    std::vector<uint32_t> leader;
+    FloatArray slotX, slotY, slotZ;
+
+    explicit SwarmBehaviours(const FlockParams& params = FlockParams());
+
+    // every groupSize consecutive UAVs keep their current shape around the
+    // first UAV of the group, which flies the group's target
+    void captureFormation(const SwarmState& swarm, size_t groupSize);
+    void clearFormation();
+
+    // rebuild the group lists after leader was filled in directly (every
+    // leader must lead itself)
+    void linkFormation();
+
+    // swarm gained a UAV at its last index: it flies alone, as its own leader
+    void addUAV();
+
+    // same swap-remove as SwarmState::removeUAV; a removed leader hands its
+    // group to the next UAV in it, whose slot becomes the group's origin
+    void removeUAV(size_t index);
+
+    // room for capacity UAVs, so adding them does not allocate
+    void reserve(size_t capacity);
+
+    // true when any flocking weight is set / when flocking or a formation would
+    // change any target
+    bool isFlocking() const;
+    bool isActive() const;
+
+    // tick phases, see SwarmScheduler::stepOnce:
+    //   buildIndex   rebuild the neighbour grid (whole swarm, one thread)
+    //   steerRange   query neighbours and offset the targets, saving the
+    //                originals; safe on disjoint ranges while nothing moves
+    //   restoreRange put the original targets back after integration
+    void buildIndex(const SwarmState& swarm);
+    void steerRange(SwarmState& swarm, size_t begin, size_t end);
+    void restoreRange(SwarmState& swarm, size_t begin, size_t end) const;
+
+    // neighbours found for a UAV in the last steer pass, nearest first
+    const uint32_t* neighboursOf(size_t uav) const { return nearest.data() + uav * params.neighbours; }
+    size_t neighbourCount(size_t uav) const { return counts[uav]; }
+
+private:
+    SpatialHash index;
+    std::vector<uint32_t> groupNext, groupPrev; // circular list of each formation group
+    std::vector<uint32_t> nearest; // params.neighbours slots per UAV
+    std::vector<uint32_t> counts;
+    FloatArray goalX, goalY, goalZ; // targets before steering
+};
+
+#endif
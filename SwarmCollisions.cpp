@@ -0,0 +1,72 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the swarm collision phase
+*/
+
+#include "SwarmCollisions.h"
+#include "Profiler.h"
+#include <algorithm>
+
+// hash buckets handed to a worker at a time
+static const size_t BUCKET_GRAIN = 4096;
+
+// cells a few collision distances wide: most UAVs are then far enough from a
+// cell face that the query only probes their own cell
+static const float CELL_SCALE = 4.0f;
+
+// swap velocities of one contact pair (elastic collision, equal masses)
+static void swapVelocities(SwarmState& swarm, const ContactPair& pair)
+{
+    std::swap(swarm.velX[pair.first], swarm.velX[pair.second]);
+    std::swap(swarm.velY[pair.first], swarm.velY[pair.second]);
+    std::swap(swarm.velZ[pair.first], swarm.velZ[pair.second]);
+}
+
+size_t handleCollisions(SwarmState& swarm, CollisionWorkspace& work, WorkerPool& pool)
+{
+    const float dist = swarm.params.collisionDistance;
+
+    {
+        PROFILE_SCOPE("collisions.build");
+        work.grid.setCellSize(dist * CELL_SCALE);
+        work.grid.build(swarm.posX.data(), swarm.posY.data(), swarm.posZ.data(), swarm.size());
+    }
+
+    work.perWorker.resize(pool.size());
+    for (auto& contacts : work.perWorker)
+    {
+        contacts.clear();
+    }
+
+    const SpatialHash& grid = work.grid;
+    std::vector<std::vector<ContactPair> >& perWorker = work.perWorker;
+    {
+        PROFILE_SCOPE("collisions.query");
+        pool.parallelFor(grid.bucketCount(), BUCKET_GRAIN,
+            [&grid, &perWorker, dist](size_t begin, size_t end, unsigned worker)
+        {
+            grid.findPairs(begin, end, dist, perWorker[worker]);
+        });
+    }
+
+    // which worker found a pair depends on scheduling, so merge then sort
+    PROFILE_SCOPE("collisions.resolve");
+    work.contacts.clear();
+    for (const auto& contacts : perWorker)
+    {
+        work.contacts.insert(work.contacts.end(), contacts.begin(), contacts.end());
+    }
+    std::sort(work.contacts.begin(), work.contacts.end(), [](const ContactPair& a, const ContactPair& b)
+    {
+        return a.first != b.first ? a.first < b.first : a.second < b.second;
+    });
+
+    // single pass, a UAV in several contacts always sees them in the same order
+    for (const auto& pair : work.contacts)
+    {
+        swapVelocities(swarm, pair);
+    }
+    return work.contacts.size();
+}
@@ -0,0 +1,35 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the swarm collision phase (spatial hash broad phase,
+squared-distance narrow phase and the velocity-swap response of
+ECE_UAV::checkCollision) on SwarmState arrays.
+*/
+
+#ifndef SWARM_COLLISIONS_H
+#define SWARM_COLLISIONS_H
+
+#include "SwarmState.h"
+#include "SpatialHash.h"
+#include "WorkerPool.h"
+#include <vector>
+
+// reusable storage for the collision phase
+struct CollisionWorkspace
+{
+    SpatialHash grid;
+    std::vector<std::vector<ContactPair> > perWorker; // gathered without locks
+    std::vector<ContactPair> contacts;                 // merged and sorted
+};
+
+// one collision phase of the tick pipeline:
+//   1. rebuild the grid
+//   2. gather contacts in parallel into per-worker buffers
+//   3. merge and sort them by (first, second)
+//   4. apply the velocity swaps in that order on the calling thread
+// the result only depends on positions, never on thread count or scheduling.
+// returns the number of contacts
+size_t handleCollisions(SwarmState& swarm, CollisionWorkspace& work, WorkerPool& pool);
+
+#endif
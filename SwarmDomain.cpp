@@ -0,0 +1,326 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the domain-decomposed swarm slab
+*/
+
+#include "SwarmDomain.h"
+#include <algorithm>
+#include <utility>
+#include <cstring>
+#include <cmath>
+
+// one UAV on the wire: global id, then every SwarmState array in array() order
+static const size_t RECORD_SIZE = sizeof(uint32_t) + SwarmState::NUM_ARRAYS * sizeof(float);
+
+// constructor
+SwarmDomain::SwarmDomain(Transport& transport, float xMin, float xMax, float ghostWidth)
+    : transport(transport), xMin(xMin), xMax(xMax), ghostWidth(ghostWidth), owned(0),
+      migratedOut(0), migratedIn(0)
+{
+}
+
+void SwarmDomain::splitSlabs(std::vector<float>& x, int ranks, std::vector<float>& faces)
+{
+    faces.assign(ranks + 1, 0.0f);
+    faces[0] = -INFINITY;
+    faces[ranks] = INFINITY;
+
+    for (int r = 1; r < ranks; ++r)
+    {
+        if (x.empty())
+        {
+            faces[r] = 0.0f;
+            continue;
+        }
+        size_t at = x.size() * r / ranks;
+        std::nth_element(x.begin(), x.begin() + at, x.end());
+        faces[r] = x[at];
+    }
+}
+
+void SwarmDomain::addUAV(uint32_t globalId, float x, float y, float z)
+{
+    swarm.addUAV(x, y, z);
+    ids.push_back(globalId);
+    owned = swarm.size();
+}
+
+void SwarmDomain::pack(size_t uav, std::vector<char>& out) const
+{
+    size_t at = out.size();
+    out.resize(at + RECORD_SIZE);
+    char* p = &out[at];
+    std::memcpy(p, &ids[uav], sizeof(uint32_t));
+    p += sizeof(uint32_t);
+    for (size_t a = 0; a < SwarmState::NUM_ARRAYS; ++a)
+    {
+        std::memcpy(p, &swarm.array(a)[uav], sizeof(float));
+        p += sizeof(float);
+    }
+}
+
+// append every record of a message, returns how many
+size_t SwarmDomain::unpack(const std::vector<char>& in)
+{
+    const size_t count = in.size() / RECORD_SIZE;
+    const char* p = in.data();
+    for (size_t r = 0; r < count; ++r)
+    {
+        uint32_t id;
+        std::memcpy(&id, p, sizeof(uint32_t));
+        p += sizeof(uint32_t);
+        ids.push_back(id);
+        for (size_t a = 0; a < SwarmState::NUM_ARRAYS; ++a)
+        {
+            float v;
+            std::memcpy(&v, p, sizeof(float));
+            p += sizeof(float);
+            swarm.array(a).push_back(v);
+        }
+    }
+    return count;
+}
+
+// swap-remove, only valid while there are no ghosts
+void SwarmDomain::removeOwned(size_t uav)
+{
+    const size_t last = swarm.size() - 1;
+    for (size_t a = 0; a < SwarmState::NUM_ARRAYS; ++a)
+    {
+        FloatArray& values = swarm.array(a);
+        values[uav] = values[last];
+        values.pop_back();
+    }
+    ids[uav] = ids[last];
+    ids.pop_back();
+    --owned;
+}
+
+void SwarmDomain::truncate(size_t count)
+{
+    for (size_t a = 0; a < SwarmState::NUM_ARRAYS; ++a)
+    {
+        swarm.array(a).resize(count);
+    }
+    ids.resize(count);
+}
+
+// send one buffer to each neighbour slab, received buffers replace them
+bool SwarmDomain::swapWithNeighbours(std::vector<char>& toLeft, std::vector<char>& toRight)
+{
+    const int rank = transport.rank();
+    const bool hasLeft = rank > 0;
+    const bool hasRight = rank + 1 < transport.size();
+
+    messages.resize((hasLeft ? 1 : 0) + (hasRight ? 1 : 0));
+    size_t m = 0;
+    if (hasLeft)
+    {
+        messages[m].peer = rank - 1;
+        messages[m++].outgoing.swap(toLeft);
+    }
+    if (hasRight)
+    {
+        messages[m].peer = rank + 1;
+        messages[m++].outgoing.swap(toRight);
+    }
+    if (!transport.exchange(messages))
+    {
+        return false;
+    }
+
+    toLeft.clear();
+    toRight.clear();
+    m = 0;
+    if (hasLeft)
+    {
+        toLeft.swap(messages[m++].incoming);
+    }
+    if (hasRight)
+    {
+        toRight.swap(messages[m++].incoming);
+    }
+    return true;
+}
+
+// a UAV goes one slab per call, one that crossed several keeps moving on from
+// the neighbour at the next call
+bool SwarmDomain::migrate()
+{
+    std::vector<char> left, right;
+    size_t i = 0;
+    while (i < owned)
+    {
+        const float x = swarm.posX[i];
+        if (x < xMin && transport.rank() > 0)
+        {
+            pack(i, left);
+            removeOwned(i);
+        }
+        else if (x >= xMax && transport.rank() + 1 < transport.size())
+        {
+            pack(i, right);
+            removeOwned(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    migratedOut += (left.size() + right.size()) / RECORD_SIZE;
+
+    if (!swapWithNeighbours(left, right))
+    {
+        return false;
+    }
+    size_t arrived = unpack(left) + unpack(right);
+    owned += arrived;
+    migratedIn += arrived;
+    return true;
+}
+
+bool SwarmDomain::exchange()
+{
+    truncate(owned);
+    if (!migrate())
+    {
+        return false;
+    }
+
+    // ghosts: owned UAVs near either face, copied to that neighbour
+    std::vector<char> left, right;
+    for (size_t k = 0; k < owned; ++k)
+    {
+        const float x = swarm.posX[k];
+        if (x < xMin + ghostWidth)
+        {
+            pack(k, left);
+        }
+        if (x >= xMax - ghostWidth)
+        {
+            pack(k, right);
+        }
+    }
+    if (!swapWithNeighbours(left, right))
+    {
+        return false;
+    }
+    unpack(left);
+    unpack(right);
+    return true;
+}
+
+// quantiles of each slab stand in for its UAVs, weighted by the slab's count
+static const size_t REBALANCE_QUANTILES = 32;
+
+bool SwarmDomain::rebalance()
+{
+    truncate(owned);
+
+    std::vector<double> mine(REBALANCE_QUANTILES + 1, 0.0);
+    mine[0] = static_cast<double>(owned);
+    if (owned > 0)
+    {
+        std::vector<float> x(swarm.posX.begin(), swarm.posX.begin() + owned);
+        std::sort(x.begin(), x.end());
+        for (size_t q = 0; q < REBALANCE_QUANTILES; ++q)
+        {
+            mine[q + 1] = x[(2 * q + 1) * owned / (2 * REBALANCE_QUANTILES)];
+        }
+    }
+    std::vector<double> all;
+    if (!gatherBlocks(mine, all))
+    {
+        return false;
+    }
+
+    // every rank merges the same samples, so every rank gets the same faces
+    const int ranks = transport.size();
+    std::vector<std::pair<double, double> > samples; // (x, weight)
+    double total = 0.0;
+    for (int r = 0; r < ranks; ++r)
+    {
+        const double* block = &all[r * mine.size()];
+        total += block[0];
+        for (size_t q = 0; q < REBALANCE_QUANTILES && block[0] > 0.0; ++q)
+        {
+            samples.push_back(std::make_pair(block[q + 1], block[0] / REBALANCE_QUANTILES));
+        }
+    }
+    std::sort(samples.begin(), samples.end());
+
+    std::vector<float> faces(ranks + 1);
+    faces[0] = -INFINITY;
+    faces[ranks] = INFINITY;
+    size_t s = 0;
+    double below = 0.0;
+    for (int r = 1; r < ranks; ++r)
+    {
+        const double wanted = total * r / ranks;
+        while (s + 1 < samples.size() && below + samples[s].second < wanted)
+        {
+            below += samples[s++].second;
+        }
+        faces[r] = samples.empty() ? 0.0f : static_cast<float>(samples[s].first);
+    }
+    xMin = faces[transport.rank()];
+    xMax = faces[transport.rank() + 1];
+
+    // a UAV may now belong several slabs away
+    for (int round = 1; round < ranks; ++round)
+    {
+        if (!migrate())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SwarmDomain::gather(double value, std::vector<double>& perRank)
+{
+    return gatherBlocks(std::vector<double>(1, value), perRank);
+}
+
+// every rank learns every block: blocks spread one slab per round, so after
+// ranks - 1 rounds of neighbour exchanges they have crossed the whole chain.
+// NaN marks a block not seen yet
+bool SwarmDomain::gatherBlocks(const std::vector<double>& mine, std::vector<double>& all)
+{
+    const int ranks = transport.size();
+    const size_t block = mine.size();
+    const size_t bytes = ranks * block * sizeof(double);
+    all.assign(ranks * block, NAN);
+    std::copy(mine.begin(), mine.end(), all.begin() + transport.rank() * block);
+
+    for (int round = 1; round < ranks; ++round)
+    {
+        std::vector<char> left(bytes), right(bytes);
+        std::memcpy(left.data(), all.data(), bytes);
+        std::memcpy(right.data(), all.data(), bytes);
+        if (!swapWithNeighbours(left, right))
+        {
+            return false;
+        }
+
+        for (const std::vector<char>* in : { &left, &right })
+        {
+            if (in->size() != bytes)
+            {
+                continue; // no neighbour on this side
+            }
+            for (int r = 0; r < ranks; ++r)
+            {
+                double first;
+                std::memcpy(&first, in->data() + r * block * sizeof(double), sizeof(double));
+                if (std::isnan(all[r * block]) && !std::isnan(first))
+                {
+                    std::memcpy(&all[r * block], in->data() + r * block * sizeof(double), block * sizeof(double));
+                }
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,90 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for one process's share of a domain-decomposed swarm. The
+field is cut into slabs along x, one per rank, holding about the same number of
+UAVs at the start. Each rank steps only the UAVs inside its slab. Before every
+tick it:
+  1. drops last tick's ghosts
+  2. hands UAVs that left the slab to the neighbouring rank (migration)
+  3. receives copies of the neighbours' UAVs within ghostWidth of the slab faces
+     (ghosts), appended after its own UAVs
+Ghosts are stepped along with the owned UAVs so collisions and flocking see
+them after integration too; their results are thrown away at the next exchange.
+As the swarm gathers (every UAV converging on one sphere, say) the slabs drift
+out of balance; rebalance() moves the faces back to equal UAV counts.
+*/
+
+#ifndef SWARM_DOMAIN_H
+#define SWARM_DOMAIN_H
+
+#include "SwarmState.h"
+#include "Transport.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class SwarmDomain
+{
+public:
+    // the slab [xMin, xMax) of transport's rank; the first and last rank's
+    // outer faces should be -/+infinity
+    SwarmDomain(Transport& transport, float xMin, float xMax, float ghostWidth);
+
+    // ranks + 1 slab faces splitting x coordinates (a sample of the swarm's,
+    // reordered) into slabs of equal count, the same on every rank for the
+    // same sample
+    static void splitSlabs(std::vector<float>& sampleX, int ranks, std::vector<float>& faces);
+
+    // add a UAV of this slab at rest, before the first exchange; state().params
+    // should be set first (the targets start on its sphere)
+    void addUAV(uint32_t globalId, float x, float y, float z);
+
+    // ghosts out, migration, ghosts in; false if the transport failed
+    bool exchange();
+
+    // collective: move the slab faces to equal UAV counts (estimated from
+    // quantiles of every slab) and migrate until every UAV is in its slab
+    bool rebalance();
+
+    // one value per rank, collective (every rank must call it)
+    bool gather(double value, std::vector<double>& perRank);
+
+    // owned UAVs are [0, ownedCount()), ghosts follow
+    SwarmState& state() { return swarm; }
+    const SwarmState& state() const { return swarm; }
+    size_t ownedCount() const { return owned; }
+    size_t ghostCount() const { return swarm.size() - owned; }
+    uint32_t globalId(size_t uav) const { return ids[uav]; }
+    float getMinX() const { return xMin; }
+    float getMaxX() const { return xMax; }
+
+    // UAVs handed over to / taken from neighbours since the start
+    unsigned long long getMigratedOut() const { return migratedOut; }
+    unsigned long long getMigratedIn() const { return migratedIn; }
+
+private:
+    void pack(size_t uav, std::vector<char>& out) const;
+    size_t unpack(const std::vector<char>& in);
+    void removeOwned(size_t uav);
+    void truncate(size_t count);
+    bool swapWithNeighbours(std::vector<char>& toLeft, std::vector<char>& toRight);
+    bool migrate();
+    bool gatherBlocks(const std::vector<double>& mine, std::vector<double>& all);
+
+    Transport& transport;
+    float xMin, xMax;
+    float ghostWidth;
+
+    SwarmState swarm;
+    std::vector<uint32_t> ids;
+    size_t owned;
+    unsigned long long migratedOut;
+    unsigned long long migratedIn;
+
+    // message storage reused between ticks
+    std::vector<PeerMessage> messages;
+};
+
+#endif
@@ -0,0 +1,647 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Vectorized swarm stepping kernels. The kernel body is written once as a
+template over a small set of register operations; AVX (8 lanes), SSE (4 lanes) and
+scalar (1 lane) backends plug into it. Branches from ECE_UAV::applyPIDControl()
+become lane masks and blends.
+*/
+
+#include "SwarmKernels.h"
+#include "MissionEngine.h"
+#include <cmath>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SWARM_HAVE_SSE 1
+#endif
+
+// scalar backend: one UAV per "register"
+struct ScalarOps
+{
+    typedef float Reg;
+    typedef bool Mask;
+    static const size_t width = 1;
+
+    static Reg load(const float* p) { return *p; }
+    static void store(float* p, Reg v) { *p = v; }
+    static Reg set1(float v) { return v; }
+    static Reg add(Reg a, Reg b) { return a + b; }
+    static Reg sub(Reg a, Reg b) { return a - b; }
+    static Reg mul(Reg a, Reg b) { return a * b; }
+    static Reg div(Reg a, Reg b) { return a / b; }
+    static Reg sqrt(Reg a) { return std::sqrt(a); }
+    static Reg min(Reg a, Reg b) { return a < b ? a : b; }
+    static Reg max(Reg a, Reg b) { return a > b ? a : b; }
+    static Mask lt(Reg a, Reg b) { return a < b; }
+    // mask ? b : a
+    static Reg blend(Reg a, Reg b, Mask m) { return m ? b : a; }
+    // bit k set if lane k is set
+    static int bits(Mask m) { return m ? 1 : 0; }
+};
+
+#ifdef SWARM_HAVE_SSE
+// SSE backend: four UAVs per register
+struct SseOps
+{
+    typedef __m128 Reg;
+    typedef __m128 Mask;
+    static const size_t width = 4;
+
+    static Reg load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Reg v) { _mm_storeu_ps(p, v); }
+    static Reg set1(float v) { return _mm_set1_ps(v); }
+    static Reg add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+    static Reg sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+    static Reg div(Reg a, Reg b) { return _mm_div_ps(a, b); }
+    static Reg sqrt(Reg a) { return _mm_sqrt_ps(a); }
+    static Reg min(Reg a, Reg b) { return _mm_min_ps(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm_max_ps(a, b); }
+    static Mask lt(Reg a, Reg b) { return _mm_cmplt_ps(a, b); }
+    static Reg blend(Reg a, Reg b, Mask m) { return _mm_or_ps(_mm_and_ps(m, b), _mm_andnot_ps(m, a)); }
+    static int bits(Mask m) { return _mm_movemask_ps(m); }
+};
+#endif
+
+#if defined(__AVX__)
+// AVX backend: eight UAVs per register
+struct AvxOps
+{
+    typedef __m256 Reg;
+    typedef __m256 Mask;
+    static const size_t width = 8;
+
+    static Reg load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, Reg v) { _mm256_storeu_ps(p, v); }
+    static Reg set1(float v) { return _mm256_set1_ps(v); }
+    static Reg add(Reg a, Reg b) { return _mm256_add_ps(a, b); }
+    static Reg sub(Reg a, Reg b) { return _mm256_sub_ps(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm256_mul_ps(a, b); }
+    static Reg div(Reg a, Reg b) { return _mm256_div_ps(a, b); }
+    static Reg sqrt(Reg a) { return _mm256_sqrt_ps(a); }
+    static Reg min(Reg a, Reg b) { return _mm256_min_ps(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm256_max_ps(a, b); }
+    static Mask lt(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Reg blend(Reg a, Reg b, Mask m) { return _mm256_blendv_ps(a, b, m); }
+    static int bits(Mask m) { return _mm256_movemask_ps(m); }
+};
+#endif
+
+// closest point on the params sphere for the UAVs at (px, py, pz); a UAV at
+// the center (no closest point) is sent to the top of the sphere
+template <typename Ops>
+static inline void sphereTarget(const SwarmParams& p, typename Ops::Reg px, typename Ops::Reg py,
+                                typename Ops::Reg pz, typename Ops::Reg& tx, typename Ops::Reg& ty,
+                                typename Ops::Reg& tz)
+{
+    typedef typename Ops::Reg Reg;
+    typedef typename Ops::Mask Mask;
+
+    const Reg cx = Ops::set1(p.centerX);
+    const Reg cy = Ops::set1(p.centerY);
+    const Reg cz = Ops::set1(p.centerZ);
+
+    // vector from sphere center to UAV
+    Reg dx = Ops::sub(px, cx);
+    Reg dy = Ops::sub(py, cy);
+    Reg dz = Ops::sub(pz, cz);
+    Reg currRad = Ops::sqrt(Ops::add(Ops::add(Ops::mul(dx, dx), Ops::mul(dy, dy)), Ops::mul(dz, dz)));
+
+    const Reg minRad = Ops::set1(0.01f);
+    Mask atCenter = Ops::lt(currRad, minRad);
+
+    // center + unit direction * radius
+    Reg scale = Ops::div(Ops::set1(p.radius), Ops::max(currRad, minRad));
+    tx = Ops::blend(Ops::add(cx, Ops::mul(dx, scale)), cx, atCenter);
+    ty = Ops::blend(Ops::add(cy, Ops::mul(dy, scale)), cy, atCenter);
+    tz = Ops::blend(Ops::add(cz, Ops::mul(dz, scale)), Ops::add(cz, Ops::set1(p.radius)), atCenter);
+}
+
+template <typename Ops>
+static inline void sphereTargetLanes(SwarmState& s, size_t i)
+{
+    typedef typename Ops::Reg Reg;
+
+    Reg tx, ty, tz;
+    sphereTarget<Ops>(s.params, Ops::load(&s.posX[i]), Ops::load(&s.posY[i]), Ops::load(&s.posZ[i]),
+                      tx, ty, tz);
+    Ops::store(&s.targetX[i], tx);
+    Ops::store(&s.targetY[i], ty);
+    Ops::store(&s.targetZ[i], tz);
+}
+
+// mission UAVs: test every lane against its waypoint tolerance at once, only
+// lanes that arrived drop to the scalar advance(); sphere UAVs get their target
+template <typename Ops>
+static inline void missionTargetLanes(SwarmState& s, MissionEngine& m, size_t i)
+{
+    typedef typename Ops::Reg Reg;
+    typedef typename Ops::Mask Mask;
+
+    Reg px = Ops::load(&s.posX[i]);
+    Reg py = Ops::load(&s.posY[i]);
+    Reg pz = Ops::load(&s.posZ[i]);
+    Reg tx = Ops::load(&s.targetX[i]);
+    Reg ty = Ops::load(&s.targetY[i]);
+    Reg tz = Ops::load(&s.targetZ[i]);
+
+    Reg sx, sy, sz;
+    sphereTarget<Ops>(s.params, px, py, pz, sx, sy, sz);
+    Mask sphere = Ops::lt(Ops::set1(0.5f), Ops::load(&m.followSphere[i]));
+    Ops::store(&s.targetX[i], Ops::blend(tx, sx, sphere));
+    Ops::store(&s.targetY[i], Ops::blend(ty, sy, sphere));
+    Ops::store(&s.targetZ[i], Ops::blend(tz, sz, sphere));
+
+    // squared distance, sphere and holding lanes have a negative tolerance
+    Reg dx = Ops::sub(tx, px);
+    Reg dy = Ops::sub(ty, py);
+    Reg dz = Ops::sub(tz, pz);
+    Reg distSq = Ops::add(Ops::add(Ops::mul(dx, dx), Ops::mul(dy, dy)), Ops::mul(dz, dz));
+    int reached = Ops::bits(Ops::lt(distSq, Ops::load(&m.toleranceSq[i])));
+
+    for (size_t lane = 0; reached; ++lane, reached >>= 1)
+    {
+        if (reached & 1)
+        {
+            m.advance(s, i + lane);
+        }
+    }
+}
+
+// The default Euler step runs the discrete PID of ECE_UAV::applyPIDControl:
+// integral += e dt, derivative = (e - lastError) / dt, so the kernels and
+// ECE_UAV steer the same way even when the target moves between ticks.
+// The higher order integrators need the force as a function of the state, so
+// within a tick they hold the target and integrate the PID in continuous form
+// together with the airframe (derivative on measurement, de/dt = -v), per axis:
+//     dI/dt = T - p
+//     F     = clamp(kp (T - p) + ki I - kd v - drag v, +-maxForce)
+//     dv/dt = F / m + g,   dp/dt = v
+// For a fixed target this is the limit of the discrete PID as dt -> 0
+template <typename Ops>
+struct LaneState
+{
+    typename Ops::Reg p[3], v[3], integ[3];
+};
+
+// d/dt of a LaneState
+template <typename Ops>
+struct LaneRate
+{
+    typename Ops::Reg dp[3], dv[3], dinteg[3];
+};
+
+// y += h * k
+template <typename Ops>
+static inline void addRate(LaneState<Ops>& y, const LaneRate<Ops>& k, typename Ops::Reg h)
+{
+    for (int a = 0; a < 3; ++a)
+    {
+        y.p[a] = Ops::add(y.p[a], Ops::mul(k.dp[a], h));
+        y.v[a] = Ops::add(y.v[a], Ops::mul(k.dv[a], h));
+        y.integ[a] = Ops::add(y.integ[a], Ops::mul(k.dinteg[a], h));
+    }
+}
+
+// sum += w * k, stage increments are summed before they touch the state so
+// small steps do not round away against large float positions
+template <typename Ops>
+static inline void accumulate(LaneRate<Ops>& sum, const LaneRate<Ops>& k, typename Ops::Reg w)
+{
+    for (int a = 0; a < 3; ++a)
+    {
+        sum.dp[a] = Ops::add(sum.dp[a], Ops::mul(k.dp[a], w));
+        sum.dv[a] = Ops::add(sum.dv[a], Ops::mul(k.dv[a], w));
+        sum.dinteg[a] = Ops::add(sum.dinteg[a], Ops::mul(k.dinteg[a], w));
+    }
+}
+
+// constants of the closed-loop model for Ops::width UAVs
+template <typename Ops>
+struct LaneModel
+{
+    typedef typename Ops::Reg Reg;
+
+    Reg target[3], kp[3], ki[3], kd[3], gravity[3];
+    Reg drag, minF, maxF, invMass;
+
+    LaneModel(const SwarmState& s, size_t i)
+    {
+        const SwarmParams& p = s.params;
+        target[0] = Ops::load(&s.targetX[i]);
+        target[1] = Ops::load(&s.targetY[i]);
+        target[2] = Ops::load(&s.targetZ[i]);
+        kp[0] = Ops::set1(p.kpX); ki[0] = Ops::set1(p.kiX); kd[0] = Ops::set1(p.kdX);
+        kp[1] = Ops::set1(p.kpY); ki[1] = Ops::set1(p.kiY); kd[1] = Ops::set1(p.kdY);
+        kp[2] = Ops::set1(p.kpZ); ki[2] = Ops::set1(p.kiZ); kd[2] = Ops::set1(p.kdZ);
+        gravity[0] = gravity[1] = Ops::set1(0.0f);
+        gravity[2] = Ops::set1(p.gravity);
+        drag = Ops::set1(p.dragCoeff);
+        maxF = Ops::set1(p.maxForcePerAxis);
+        minF = Ops::set1(-p.maxForcePerAxis);
+        invMass = Ops::set1(1.0f / p.mass);
+    }
+
+    Reg error(const LaneState<Ops>& y, int a) const
+    {
+        return Ops::sub(target[a], y.p[a]);
+    }
+
+    // control + drag acceleration on one axis, gravity excluded
+    Reg control(const LaneState<Ops>& y, int a) const
+    {
+        Reg f = Ops::sub(Ops::add(Ops::mul(kp[a], error(y, a)), Ops::mul(ki[a], y.integ[a])),
+                         Ops::mul(Ops::add(kd[a], drag), y.v[a]));
+        return Ops::mul(Ops::min(maxF, Ops::max(minF, f)), invMass);
+    }
+
+    // same with the discrete PID's derivative of the error in place of -v
+    Reg discreteControl(const LaneState<Ops>& y, int a, Reg derivative) const
+    {
+        Reg f = Ops::add(Ops::add(Ops::mul(kp[a], error(y, a)), Ops::mul(ki[a], y.integ[a])),
+                         Ops::sub(Ops::mul(kd[a], derivative), Ops::mul(drag, y.v[a])));
+        return Ops::mul(Ops::min(maxF, Ops::max(minF, f)), invMass);
+    }
+
+    void rate(const LaneState<Ops>& y, LaneRate<Ops>& k) const
+    {
+        for (int a = 0; a < 3; ++a)
+        {
+            k.dp[a] = y.v[a];
+            k.dv[a] = Ops::add(control(y, a), gravity[a]);
+            k.dinteg[a] = error(y, a);
+        }
+    }
+};
+
+// semi-implicit Euler with the discrete PID: integral, then velocity, then
+// position from the new velocity (one evaluation); lastError is the error of
+// the previous tick, acc gets the control acceleration of the step
+template <typename Ops>
+static inline void eulerStep(const LaneModel<Ops>& m, LaneState<Ops>& y, const typename Ops::Reg* lastError,
+                             typename Ops::Reg h, typename Ops::Reg invH, typename Ops::Reg* acc)
+{
+    for (int a = 0; a < 3; ++a)
+    {
+        typename Ops::Reg e = m.error(y, a);
+        y.integ[a] = Ops::add(y.integ[a], Ops::mul(e, h));
+        acc[a] = m.discreteControl(y, a, Ops::mul(Ops::sub(e, lastError[a]), invH));
+        y.v[a] = Ops::add(y.v[a], Ops::mul(Ops::add(acc[a], m.gravity[a]), h));
+        y.p[a] = Ops::add(y.p[a], Ops::mul(y.v[a], h));
+    }
+}
+
+// velocity Verlet; the force depends on velocity, so the end-of-step force is
+// taken at a predicted velocity v + a h (two evaluations)
+template <typename Ops>
+static inline void verletStep(const LaneModel<Ops>& m, LaneState<Ops>& y, typename Ops::Reg h,
+                              typename Ops::Reg* acc)
+{
+    typedef typename Ops::Reg Reg;
+    const Reg half = Ops::set1(0.5f);
+    const Reg halfH = Ops::mul(half, h);
+
+    LaneState<Ops> end = y;
+    Reg a0[3];
+    for (int a = 0; a < 3; ++a)
+    {
+        acc[a] = m.control(y, a);
+        a0[a] = Ops::add(acc[a], m.gravity[a]);
+        end.p[a] = Ops::add(y.p[a], Ops::mul(h, Ops::add(y.v[a], Ops::mul(halfH, a0[a]))));
+        end.v[a] = Ops::add(y.v[a], Ops::mul(a0[a], h));
+    }
+    for (int a = 0; a < 3; ++a)
+    {
+        // trapezoidal integral of the error over the step
+        end.integ[a] = Ops::add(y.integ[a], Ops::mul(halfH, Ops::add(m.error(y, a), m.error(end, a))));
+    }
+    for (int a = 0; a < 3; ++a)
+    {
+        Reg a1 = Ops::add(m.control(end, a), m.gravity[a]);
+        y.v[a] = Ops::add(y.v[a], Ops::mul(halfH, Ops::add(a0[a], a1)));
+        y.p[a] = end.p[a];
+        y.integ[a] = end.integ[a];
+    }
+}
+
+// classic fourth order Runge-Kutta (four evaluations)
+template <typename Ops>
+static inline void rk4Step(const LaneModel<Ops>& m, LaneState<Ops>& y, typename Ops::Reg h,
+                           typename Ops::Reg* acc)
+{
+    typedef typename Ops::Reg Reg;
+    const Reg one = Ops::set1(1.0f);
+    const Reg two = Ops::set1(2.0f);
+    const Reg halfH = Ops::mul(Ops::set1(0.5f), h);
+
+    LaneRate<Ops> k, sum;
+    LaneState<Ops> stage = y;
+
+    m.rate(y, k);
+    for (int a = 0; a < 3; ++a)
+    {
+        acc[a] = Ops::sub(k.dv[a], m.gravity[a]);
+    }
+    sum = k;
+    addRate<Ops>(stage, k, halfH);
+
+    m.rate(stage, k);
+    accumulate<Ops>(sum, k, two);
+    stage = y;
+    addRate<Ops>(stage, k, halfH);
+
+    m.rate(stage, k);
+    accumulate<Ops>(sum, k, two);
+    stage = y;
+    addRate<Ops>(stage, k, h);
+
+    m.rate(stage, k);
+    accumulate<Ops>(sum, k, one);
+    addRate<Ops>(y, sum, Ops::mul(Ops::set1(1.0f / 6.0f), h));
+}
+
+// largest lane of v
+template <typename Ops>
+static inline float laneMax(typename Ops::Reg v)
+{
+    float lanes[Ops::width];
+    Ops::store(lanes, v);
+    float result = lanes[0];
+    for (size_t l = 1; l < Ops::width; ++l)
+    {
+        result = lanes[l] > result ? lanes[l] : result;
+    }
+    return result;
+}
+
+// Bogacki-Shampine 3(2) pair: y advances with the third order result, the
+// return value is the largest local error estimate over the lanes, as a
+// displacement (position error, velocity error times h)
+template <typename Ops>
+static inline float bogackiShampineStep(const LaneModel<Ops>& m, LaneState<Ops>& y, float step,
+                                        typename Ops::Reg* acc)
+{
+    typedef typename Ops::Reg Reg;
+    const Reg h = Ops::set1(step);
+
+    LaneRate<Ops> k1, k2, k3, k4;
+    LaneState<Ops> stage = y;
+
+    m.rate(y, k1);
+    addRate<Ops>(stage, k1, Ops::mul(Ops::set1(0.5f), h));
+    m.rate(stage, k2);
+    stage = y;
+    addRate<Ops>(stage, k2, Ops::mul(Ops::set1(0.75f), h));
+    m.rate(stage, k3);
+
+    LaneRate<Ops> sum = k1;
+    LaneState<Ops> third = y;
+    accumulate<Ops>(sum, k2, Ops::set1(1.5f));
+    accumulate<Ops>(sum, k3, Ops::set1(2.0f));
+    addRate<Ops>(third, sum, Ops::mul(Ops::set1(2.0f / 9.0f), h));
+    m.rate(third, k4);
+
+    // second order estimate minus the third order one, from the stage weights
+    const Reg e1 = Ops::mul(Ops::set1(7.0f / 24.0f - 2.0f / 9.0f), h);
+    const Reg e2 = Ops::mul(Ops::set1(1.0f / 4.0f - 1.0f / 3.0f), h);
+    const Reg e3 = Ops::mul(Ops::set1(1.0f / 3.0f - 4.0f / 9.0f), h);
+    const Reg e4 = Ops::mul(Ops::set1(1.0f / 8.0f), h);
+    const Reg zero = Ops::set1(0.0f);
+
+    Reg err = zero;
+    for (int a = 0; a < 3; ++a)
+    {
+        Reg dp = Ops::add(Ops::add(Ops::mul(k1.dp[a], e1), Ops::mul(k2.dp[a], e2)),
+                          Ops::add(Ops::mul(k3.dp[a], e3), Ops::mul(k4.dp[a], e4)));
+        Reg dv = Ops::add(Ops::add(Ops::mul(k1.dv[a], e1), Ops::mul(k2.dv[a], e2)),
+                          Ops::add(Ops::mul(k3.dv[a], e3), Ops::mul(k4.dv[a], e4)));
+        dv = Ops::mul(dv, h);
+        err = Ops::max(err, Ops::max(Ops::max(dp, Ops::sub(zero, dp)), Ops::max(dv, Ops::sub(zero, dv))));
+        acc[a] = Ops::sub(k1.dv[a], m.gravity[a]);
+    }
+
+    y = third;
+    return laneMax<Ops>(err);
+}
+
+// adaptive substeps over one tick: a step is retried smaller while any lane's
+// error estimate exceeds the tolerance, and the next step is sized from the
+// last estimate (error ~ h^3)
+template <typename Ops>
+static inline void adaptiveTick(const LaneModel<Ops>& m, LaneState<Ops>& y, float dt, float tolerance,
+                                typename Ops::Reg* acc)
+{
+    const float minStep = dt / 256.0f;
+    float remaining = dt;
+    float h = dt;
+
+    // control acceleration at the start of the tick, also what a tick with no
+    // substeps (dt <= 0) reports
+    for (int a = 0; a < 3; ++a)
+    {
+        acc[a] = m.control(y, a);
+    }
+
+    while (remaining > dt * 1e-6f)
+    {
+        h = (h > remaining) ? remaining : h;
+
+        LaneState<Ops> trial = y;
+        typename Ops::Reg trialAcc[3];
+        float err = bogackiShampineStep<Ops>(m, trial, h, trialAcc);
+
+        if (err > tolerance && h > minStep)
+        {
+            float shrink = 0.9f * std::cbrt(tolerance / err);
+            h *= (shrink < 0.2f) ? 0.2f : shrink;
+            continue;
+        }
+
+        y = trial;
+        remaining -= h;
+
+        float grow = (err > 0.0f) ? 0.9f * std::cbrt(tolerance / err) : 5.0f;
+        h *= (grow > 5.0f) ? 5.0f : grow;
+    }
+}
+
+// one tick for Ops::width UAVs starting at i toward targetX/Y/Z with the
+// Method integrator (a SwarmIntegrator value)
+template <typename Ops, int Method>
+static inline void stepLanes(SwarmState& s, size_t i)
+{
+    typedef typename Ops::Reg Reg;
+    typedef typename Ops::Mask Mask;
+    const SwarmParams& p = s.params;
+
+    LaneModel<Ops> model(s, i);
+    LaneState<Ops> y;
+    y.p[0] = Ops::load(&s.posX[i]);
+    y.p[1] = Ops::load(&s.posY[i]);
+    y.p[2] = Ops::load(&s.posZ[i]);
+    y.v[0] = Ops::load(&s.velX[i]);
+    y.v[1] = Ops::load(&s.velY[i]);
+    y.v[2] = Ops::load(&s.velZ[i]);
+    y.integ[0] = Ops::load(&s.integralX[i]);
+    y.integ[1] = Ops::load(&s.integralY[i]);
+    y.integ[2] = Ops::load(&s.integralZ[i]);
+
+    // position error the controller starts the tick with, the previous one
+    // feeds the Euler step's derivative
+    Reg lastError[3] = { Ops::load(&s.lastErrorX[i]), Ops::load(&s.lastErrorY[i]), Ops::load(&s.lastErrorZ[i]) };
+    Ops::store(&s.lastErrorX[i], model.error(y, 0));
+    Ops::store(&s.lastErrorY[i], model.error(y, 1));
+    Ops::store(&s.lastErrorZ[i], model.error(y, 2));
+
+    const Reg dt = Ops::set1(p.dt);
+    Reg acc[3];
+    switch (Method)
+    {
+    case INTEGRATOR_VERLET:
+        verletStep<Ops>(model, y, dt, acc);
+        break;
+    case INTEGRATOR_RK4:
+        rk4Step<Ops>(model, y, dt, acc);
+        break;
+    case INTEGRATOR_ADAPTIVE:
+        adaptiveTick<Ops>(model, y, p.dt, p.tolerance, acc);
+        break;
+    default:
+        eulerStep<Ops>(model, y, lastError, dt, Ops::set1(p.dt > 0.0f ? 1.0f / p.dt : 0.0f), acc);
+        break;
+    }
+
+    // dont want to go below z = 0
+    const Reg zero = Ops::set1(0.0f);
+    Mask below = Ops::lt(y.p[2], zero);
+    y.p[2] = Ops::max(y.p[2], zero);
+    y.v[2] = Ops::blend(y.v[2], Ops::max(y.v[2], zero), below);
+
+    Ops::store(&s.posX[i], y.p[0]);
+    Ops::store(&s.posY[i], y.p[1]);
+    Ops::store(&s.posZ[i], y.p[2]);
+    Ops::store(&s.velX[i], y.v[0]);
+    Ops::store(&s.velY[i], y.v[1]);
+    Ops::store(&s.velZ[i], y.v[2]);
+    Ops::store(&s.accX[i], acc[0]);
+    Ops::store(&s.accY[i], acc[1]);
+    Ops::store(&s.accZ[i], acc[2]);
+    Ops::store(&s.integralX[i], y.integ[0]);
+    Ops::store(&s.integralY[i], y.integ[1]);
+    Ops::store(&s.integralZ[i], y.integ[2]);
+}
+
+// full SIMD iterations, then a scalar tail
+template <typename Ops, int Method>
+static void stepRangeWith(SwarmState& s, size_t begin, size_t end)
+{
+    size_t i = begin;
+    for (; i + Ops::width <= end; i += Ops::width)
+    {
+        stepLanes<Ops, Method>(s, i);
+    }
+    for (; i < end; ++i)
+    {
+        stepLanes<ScalarOps, Method>(s, i);
+    }
+}
+
+// one switch per range, the integrator is a template argument inside
+template <typename Ops>
+static void stepRange(SwarmState& s, size_t begin, size_t end)
+{
+    switch (s.params.integrator)
+    {
+    case INTEGRATOR_VERLET:
+        stepRangeWith<Ops, INTEGRATOR_VERLET>(s, begin, end);
+        break;
+    case INTEGRATOR_RK4:
+        stepRangeWith<Ops, INTEGRATOR_RK4>(s, begin, end);
+        break;
+    case INTEGRATOR_ADAPTIVE:
+        stepRangeWith<Ops, INTEGRATOR_ADAPTIVE>(s, begin, end);
+        break;
+    default:
+        stepRangeWith<Ops, INTEGRATOR_EULER>(s, begin, end);
+        break;
+    }
+}
+
+template <typename Ops>
+static void sphereTargetRange(SwarmState& s, size_t begin, size_t end)
+{
+    size_t i = begin;
+    for (; i + Ops::width <= end; i += Ops::width)
+    {
+        sphereTargetLanes<Ops>(s, i);
+    }
+    for (; i < end; ++i)
+    {
+        sphereTargetLanes<ScalarOps>(s, i);
+    }
+}
+
+template <typename Ops>
+static void missionTargetRange(SwarmState& s, MissionEngine& m, size_t begin, size_t end)
+{
+    size_t i = begin;
+    for (; i + Ops::width <= end; i += Ops::width)
+    {
+        missionTargetLanes<Ops>(s, m, i);
+    }
+    for (; i < end; ++i)
+    {
+        missionTargetLanes<ScalarOps>(s, m, i);
+    }
+}
+
+void stepSwarmRangeScalar(SwarmState& swarm, size_t begin, size_t end)
+{
+    stepRange<ScalarOps>(swarm, begin, end);
+}
+
+#if defined(__AVX__)
+typedef AvxOps WideOps;
+#elif defined(SWARM_HAVE_SSE)
+typedef SseOps WideOps;
+#else
+typedef ScalarOps WideOps;
+#endif
+
+void sphereTargetsRange(SwarmState& swarm, size_t begin, size_t end)
+{
+    sphereTargetRange<WideOps>(swarm, begin, end);
+}
+
+void missionTargetsRange(SwarmState& swarm, MissionEngine& missions, size_t begin, size_t end)
+{
+    missionTargetRange<WideOps>(swarm, missions, begin, end);
+}
+
+#if defined(__AVX__)
+void stepSwarmRange(SwarmState& swarm, size_t begin, size_t end)
+{
+    stepRange<AvxOps>(swarm, begin, end);
+}
+const char* swarmKernelName() { return "avx"; }
+size_t swarmKernelWidth() { return AvxOps::width; }
+#elif defined(SWARM_HAVE_SSE)
+void stepSwarmRange(SwarmState& swarm, size_t begin, size_t end)
+{
+    stepRange<SseOps>(swarm, begin, end);
+}
+const char* swarmKernelName() { return "sse"; }
+size_t swarmKernelWidth() { return SseOps::width; }
+#else
+void stepSwarmRange(SwarmState& swarm, size_t begin, size_t end)
+{
+    stepRange<ScalarOps>(swarm, begin, end);
+}
+const char* swarmKernelName() { return "scalar"; }
+size_t swarmKernelWidth() { return ScalarOps::width; }
+#endif
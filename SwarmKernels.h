@@ -0,0 +1,39 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the vectorized swarm stepping kernels operating on
+SwarmState arrays. A tick is two passes over a range: target generation (sphere
+attractor or waypoint missions) into targetX/Y/Z, then PID toward the target,
+drag, force clamping and integration with the params.integrator method.
+*/
+
+#ifndef SWARM_KERNELS_H
+#define SWARM_KERNELS_H
+
+#include "SwarmState.h"
+#include <cstddef>
+
+class MissionEngine;
+
+// targets of UAVs [begin, end) = closest point on the params sphere
+void sphereTargetsRange(SwarmState& swarm, size_t begin, size_t end);
+
+// targets of UAVs [begin, end) from their missions: advance every UAV within
+// tolerance of its waypoint, sphere target for UAVs without a mission
+void missionTargetsRange(SwarmState& swarm, MissionEngine& missions, size_t begin, size_t end);
+
+// advance UAVs [begin, end) one tick toward their targets using the widest SIMD
+// path compiled in
+void stepSwarmRange(SwarmState& swarm, size_t begin, size_t end);
+
+// same as stepSwarmRange but always the plain scalar loop (reference / fallback)
+void stepSwarmRangeScalar(SwarmState& swarm, size_t begin, size_t end);
+
+// name of the kernel stepSwarmRange dispatches to ("avx", "sse" or "scalar")
+const char* swarmKernelName();
+
+// UAVs processed per SIMD iteration by stepSwarmRange
+size_t swarmKernelWidth();
+
+#endif
@@ -0,0 +1,156 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the pooled UAV store
+*/
+
+#include "SwarmPool.h"
+#include "MissionEngine.h"
+#include "SwarmBehaviours.h"
+
+static const uint32_t NO_SLOT = 0xffffffffu;
+
+const size_t SwarmPool::CHUNK_SLOTS;
+const size_t SwarmPool::NO_INDEX;
+
+SwarmPool::SwarmPool(SwarmState& swarm, size_t capacity)
+    : swarm(swarm), missions(nullptr), behaviours(nullptr), freeHead(NO_SLOT)
+{
+    reserve(capacity > swarm.size() ? capacity : swarm.size());
+
+    // hand the existing UAVs the first slots, in order
+    for (size_t i = 0; i < swarm.size(); ++i)
+    {
+        Slot& slot = slotAt(freeHead);
+        const uint32_t taken = freeHead;
+        freeHead = slot.nextFree;
+        slot.dense = static_cast<uint32_t>(i);
+        denseSlot.push_back(taken);
+    }
+}
+
+void SwarmPool::addChunk()
+{
+    const uint32_t first = static_cast<uint32_t>(chunks.size() * CHUNK_SLOTS);
+    chunks.push_back(std::vector<Slot>(CHUNK_SLOTS));
+    std::vector<Slot>& chunk = chunks.back();
+
+    // link the new slots in order, ahead of any slots already free
+    for (size_t s = 0; s < CHUNK_SLOTS; ++s)
+    {
+        chunk[s].dense = 0;
+        chunk[s].generation = 1;
+        chunk[s].nextFree = (s + 1 < CHUNK_SLOTS) ? first + static_cast<uint32_t>(s + 1) : freeHead;
+    }
+    freeHead = first;
+}
+
+void SwarmPool::reserve(size_t count)
+{
+    while (capacity() < count)
+    {
+        addChunk();
+    }
+    swarm.reserve(capacity());
+    denseSlot.reserve(capacity());
+    if (missions)
+    {
+        missions->reserve(capacity());
+    }
+    if (behaviours)
+    {
+        behaviours->reserve(capacity());
+    }
+}
+
+void SwarmPool::setMissions(MissionEngine* plan)
+{
+    missions = plan;
+    reserve(capacity());
+}
+
+void SwarmPool::setBehaviours(SwarmBehaviours* flock)
+{
+    behaviours = flock;
+    reserve(capacity());
+}
+
+UavHandle SwarmPool::spawn(float x, float y, float z)
+{
+    if (freeHead == NO_SLOT)
+    {
+        reserve(capacity() + CHUNK_SLOTS);
+    }
+
+    const uint32_t taken = freeHead;
+    Slot& slot = slotAt(taken);
+    freeHead = slot.nextFree;
+    slot.dense = static_cast<uint32_t>(denseSlot.size());
+    denseSlot.push_back(taken);
+    swarm.addUAV(x, y, z);
+    if (missions)
+    {
+        missions->addUAV(swarm);
+    }
+    if (behaviours)
+    {
+        behaviours->addUAV();
+    }
+    return UavHandle(taken, slot.generation);
+}
+
+bool SwarmPool::retire(UavHandle handle)
+{
+    if (!isAlive(handle))
+    {
+        return false;
+    }
+
+    // the last UAV moves into the freed index
+    Slot& slot = slotAt(handle.slot);
+    const uint32_t index = slot.dense;
+    const uint32_t moved = denseSlot.back();
+    swarm.removeUAV(index);
+    if (missions)
+    {
+        missions->removeUAV(index);
+    }
+    if (behaviours)
+    {
+        behaviours->removeUAV(index);
+    }
+    denseSlot[index] = moved;
+    denseSlot.pop_back();
+    slotAt(moved).dense = index;
+
+    // stale handles to this slot stop matching
+    if (++slot.generation == 0)
+    {
+        slot.generation = 1;
+    }
+    slot.nextFree = freeHead;
+    freeHead = handle.slot;
+    return true;
+}
+
+bool SwarmPool::isAlive(UavHandle handle) const
+{
+    if (handle.isNull() || handle.slot >= capacity())
+    {
+        return false;
+    }
+    const Slot& slot = slotAt(handle.slot);
+    return slot.generation == handle.generation && slot.dense < denseSlot.size() && denseSlot[slot.dense] == handle.slot;
+}
+
+size_t SwarmPool::indexOf(UavHandle handle) const
+{
+    return isAlive(handle) ? slotAt(handle.slot).dense : NO_INDEX;
+}
+
+UavHandle SwarmPool::handleAt(size_t index) const
+{
+    const uint32_t slot = denseSlot[index];
+    return UavHandle(slot, slotAt(slot).generation);
+}
@@ -0,0 +1,106 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the pooled UAV store that lets UAVs be launched and
+retired while the swarm flies. The SwarmState arrays stay dense (retiring moves
+the last UAV into the freed index), so the stepping kernels never see holes.
+Everything outside the tick refers to a UAV by a UavHandle instead of an index:
+the handle names a slot in a table of fixed-size chunks that never move, the
+slot holds the UAV's current dense index, and a generation count in both tells
+a live UAV from a retired one whose slot was reused. Free slots form a linked
+list. Spawning and retiring are O(1) and allocate nothing while the pool is
+under its capacity.
+
+Per-UAV data kept in other dense arrays beside the swarm (mission progress,
+formation slots) is attached with setMissions / setBehaviours; the pool adds
+and swap-removes their entries together with the SwarmState ones.
+*/
+
+#ifndef SWARM_POOL_H
+#define SWARM_POOL_H
+
+#include "SwarmState.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class MissionEngine;
+class SwarmBehaviours;
+
+// names one UAV for as long as it lives; a default handle names nothing
+struct UavHandle
+{
+    uint32_t slot;
+    uint32_t generation; // 0 = never valid
+
+    UavHandle() : slot(0), generation(0) {}
+    UavHandle(uint32_t slot, uint32_t generation) : slot(slot), generation(generation) {}
+
+    bool isNull() const { return generation == 0; }
+};
+
+class SwarmPool
+{
+public:
+    static const size_t CHUNK_SLOTS = 4096;
+    static const size_t NO_INDEX = static_cast<size_t>(-1);
+
+    // manage swarm's UAVs, which get handles in index order; room for capacity
+    // UAVs (at least the current ones) is allocated up front
+    explicit SwarmPool(SwarmState& swarm, size_t capacity = 0);
+
+    // allocate slots and swarm storage for capacity UAVs, outside the tick
+    void reserve(size_t capacity);
+
+    // keep a mission engine / behaviours (sized to the swarm, nullptr = none)
+    // in step with spawns and retirements; spawned UAVs fly the launch list
+    // alone, outside any formation group
+    void setMissions(MissionEngine* missions);
+    void setBehaviours(SwarmBehaviours* behaviours);
+
+    // add a UAV at rest; allocates only when the pool is full (one more chunk)
+    UavHandle spawn(float x, float y, float z);
+
+    // remove a UAV, the last UAV takes its dense index; false if the handle is
+    // stale or null
+    bool retire(UavHandle handle);
+
+    bool isAlive(UavHandle handle) const;
+
+    // dense SwarmState index of a live UAV (NO_INDEX if not alive); changes
+    // when another UAV is retired
+    size_t indexOf(UavHandle handle) const;
+
+    // handle of the UAV at a dense index
+    UavHandle handleAt(size_t index) const;
+
+    size_t size() const { return denseSlot.size(); }
+    size_t capacity() const { return chunks.size() * CHUNK_SLOTS; }
+
+private:
+    struct Slot
+    {
+        uint32_t dense;      // index into the swarm while alive
+        uint32_t generation; // bumped on retire, never 0
+        uint32_t nextFree;   // free list link while retired
+    };
+
+    SwarmPool(const SwarmPool&);
+    SwarmPool& operator=(const SwarmPool&);
+
+    Slot& slotAt(uint32_t slot) { return chunks[slot / CHUNK_SLOTS][slot % CHUNK_SLOTS]; }
+    const Slot& slotAt(uint32_t slot) const { return chunks[slot / CHUNK_SLOTS][slot % CHUNK_SLOTS]; }
+
+    // append one chunk of free slots
+    void addChunk();
+
+    SwarmState& swarm;
+    MissionEngine* missions;
+    SwarmBehaviours* behaviours;
+    std::vector<std::vector<Slot> > chunks; // each CHUNK_SLOTS long, never resized
+    std::vector<uint32_t> denseSlot;        // slot of the UAV at each dense index
+    uint32_t freeHead;
+};
+
+#endif
@@ -0,0 +1,357 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the instanced swarm renderer. Uses GLSL 1.20 with
+ARB_instanced_arrays / ARB_draw_instanced (or GL 3.3 core entry points) so it runs
+on Mesa's llvmpipe software rasterizer. GL entry points are looked up through
+glutGetProcAddress, no loader library needed. Without instancing support the mesh
+is compiled into a display list and drawn once per UAV instead.
+*/
+
+#include "SwarmRenderer.h"
+#ifdef FREEGLUT
+#include <GL/freeglut_ext.h>
+#endif
+#include <GL/glext.h>
+#include <iostream>
+#include <algorithm>
+
+// GL entry points beyond 1.1
+static PFNGLGENBUFFERSPROC pglGenBuffers = nullptr;
+static PFNGLBINDBUFFERPROC pglBindBuffer = nullptr;
+static PFNGLBUFFERDATAPROC pglBufferData = nullptr;
+static PFNGLBUFFERSUBDATAPROC pglBufferSubData = nullptr;
+static PFNGLCREATESHADERPROC pglCreateShader = nullptr;
+static PFNGLSHADERSOURCEPROC pglShaderSource = nullptr;
+static PFNGLCOMPILESHADERPROC pglCompileShader = nullptr;
+static PFNGLGETSHADERIVPROC pglGetShaderiv = nullptr;
+static PFNGLGETSHADERINFOLOGPROC pglGetShaderInfoLog = nullptr;
+static PFNGLDELETESHADERPROC pglDeleteShader = nullptr;
+static PFNGLCREATEPROGRAMPROC pglCreateProgram = nullptr;
+static PFNGLATTACHSHADERPROC pglAttachShader = nullptr;
+static PFNGLBINDATTRIBLOCATIONPROC pglBindAttribLocation = nullptr;
+static PFNGLLINKPROGRAMPROC pglLinkProgram = nullptr;
+static PFNGLGETPROGRAMIVPROC pglGetProgramiv = nullptr;
+static PFNGLGETPROGRAMINFOLOGPROC pglGetProgramInfoLog = nullptr;
+static PFNGLDELETEPROGRAMPROC pglDeleteProgram = nullptr;
+static PFNGLUSEPROGRAMPROC pglUseProgram = nullptr;
+static PFNGLGETATTRIBLOCATIONPROC pglGetAttribLocation = nullptr;
+static PFNGLENABLEVERTEXATTRIBARRAYPROC pglEnableVertexAttribArray = nullptr;
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC pglDisableVertexAttribArray = nullptr;
+static PFNGLVERTEXATTRIBPOINTERPROC pglVertexAttribPointer = nullptr;
+static PFNGLVERTEXATTRIBDIVISORPROC pglVertexAttribDivisor = nullptr;
+static PFNGLDRAWELEMENTSINSTANCEDPROC pglDrawElementsInstanced = nullptr;
+
+// attribute slots (position must be 0 in compatibility contexts)
+static const GLuint ATTRIB_POSITION = 0;
+static const GLuint ATTRIB_NORMAL = 1;
+
+// mesh offset by the per-instance UAV position, simple directional shading
+static const char* VERTEX_SHADER =
+    "#version 120\n"
+    "attribute vec3 position;\n"
+    "attribute vec3 normal;\n"
+    "attribute float offsetX;\n"
+    "attribute float offsetY;\n"
+    "attribute float offsetZ;\n"
+    "varying float shade;\n"
+    "void main()\n"
+    "{\n"
+    "    vec3 world = position + vec3(offsetX, offsetY, offsetZ);\n"
+    "    gl_Position = gl_ModelViewProjectionMatrix * vec4(world, 1.0);\n"
+    "    vec3 n = normalize(gl_NormalMatrix * normal);\n"
+    "    shade = 0.4 + 0.6 * max(dot(n, normalize(vec3(0.3, 0.5, 1.0))), 0.0);\n"
+    "    gl_FrontColor = gl_Color;\n"
+    "}\n";
+
+static const char* FRAGMENT_SHADER =
+    "#version 120\n"
+    "varying float shade;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_FragColor = vec4(gl_Color.rgb * shade, gl_Color.a);\n"
+    "}\n";
+
+// look up a GL function, trying the core name first then the ARB one
+template <typename Proc>
+static bool loadProc(Proc& proc, const char* name, const char* arbName = nullptr)
+{
+#ifdef FREEGLUT
+    proc = reinterpret_cast<Proc>(glutGetProcAddress(name));
+    if (!proc && arbName)
+    {
+        proc = reinterpret_cast<Proc>(glutGetProcAddress(arbName));
+    }
+#else
+    (void)name;
+    (void)arbName;
+    proc = nullptr;
+#endif
+    return proc != nullptr;
+}
+
+// compile one shader stage, prints the log on failure
+static GLuint compileShader(GLenum type, const char* source)
+{
+    GLuint shader = pglCreateShader(type);
+    pglShaderSource(shader, 1, &source, nullptr);
+    pglCompileShader(shader);
+
+    GLint ok = GL_FALSE;
+    pglGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+    if (!ok)
+    {
+        char log[1024];
+        pglGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        std::cerr << "SwarmRenderer: shader compile failed: " << log << "\n";
+        pglDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+// constructor
+SwarmRenderer::SwarmRenderer()
+    : instanced(false), instanceBuffer(0),
+      program(0), offsetXLoc(-1), offsetYLoc(-1), offsetZLoc(-1)
+{
+}
+
+// destructor: buffers, program and display lists are released with the GL
+// context (the renderer usually outlives it as a global)
+SwarmRenderer::~SwarmRenderer()
+{
+}
+
+bool SwarmRenderer::isInstanced() const
+{
+    return instanced;
+}
+
+bool SwarmRenderer::loadFunctions()
+{
+    bool ok = true;
+    ok &= loadProc(pglGenBuffers, "glGenBuffers", "glGenBuffersARB");
+    ok &= loadProc(pglBindBuffer, "glBindBuffer", "glBindBufferARB");
+    ok &= loadProc(pglBufferData, "glBufferData", "glBufferDataARB");
+    ok &= loadProc(pglBufferSubData, "glBufferSubData", "glBufferSubDataARB");
+    ok &= loadProc(pglCreateShader, "glCreateShader");
+    ok &= loadProc(pglShaderSource, "glShaderSource");
+    ok &= loadProc(pglCompileShader, "glCompileShader");
+    ok &= loadProc(pglGetShaderiv, "glGetShaderiv");
+    ok &= loadProc(pglGetShaderInfoLog, "glGetShaderInfoLog");
+    ok &= loadProc(pglDeleteShader, "glDeleteShader");
+    ok &= loadProc(pglCreateProgram, "glCreateProgram");
+    ok &= loadProc(pglAttachShader, "glAttachShader");
+    ok &= loadProc(pglBindAttribLocation, "glBindAttribLocation");
+    ok &= loadProc(pglLinkProgram, "glLinkProgram");
+    ok &= loadProc(pglGetProgramiv, "glGetProgramiv");
+    ok &= loadProc(pglGetProgramInfoLog, "glGetProgramInfoLog");
+    ok &= loadProc(pglDeleteProgram, "glDeleteProgram");
+    ok &= loadProc(pglUseProgram, "glUseProgram");
+    ok &= loadProc(pglGetAttribLocation, "glGetAttribLocation");
+    ok &= loadProc(pglEnableVertexAttribArray, "glEnableVertexAttribArray");
+    ok &= loadProc(pglDisableVertexAttribArray, "glDisableVertexAttribArray");
+    ok &= loadProc(pglVertexAttribPointer, "glVertexAttribPointer");
+    ok &= loadProc(pglVertexAttribDivisor, "glVertexAttribDivisor", "glVertexAttribDivisorARB");
+    ok &= loadProc(pglDrawElementsInstanced, "glDrawElementsInstanced", "glDrawElementsInstancedARB");
+    return ok;
+}
+
+bool SwarmRenderer::buildProgram()
+{
+    GLuint vs = compileShader(GL_VERTEX_SHADER, VERTEX_SHADER);
+    GLuint fs = compileShader(GL_FRAGMENT_SHADER, FRAGMENT_SHADER);
+    if (!vs || !fs)
+    {
+        return false;
+    }
+
+    program = pglCreateProgram();
+    pglAttachShader(program, vs);
+    pglAttachShader(program, fs);
+    pglBindAttribLocation(program, ATTRIB_POSITION, "position");
+    pglBindAttribLocation(program, ATTRIB_NORMAL, "normal");
+    pglLinkProgram(program);
+
+    // shaders stay alive while attached
+    pglDeleteShader(vs);
+    pglDeleteShader(fs);
+
+    GLint ok = GL_FALSE;
+    pglGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok)
+    {
+        char log[1024];
+        pglGetProgramInfoLog(program, sizeof(log), nullptr, log);
+        std::cerr << "SwarmRenderer: program link failed: " << log << "\n";
+        pglDeleteProgram(program);
+        program = 0;
+        return false;
+    }
+
+    offsetXLoc = pglGetAttribLocation(program, "offsetX");
+    offsetYLoc = pglGetAttribLocation(program, "offsetY");
+    offsetZLoc = pglGetAttribLocation(program, "offsetZ");
+    return offsetXLoc >= 0 && offsetYLoc >= 0 && offsetZLoc >= 0;
+}
+
+bool SwarmRenderer::init(const std::vector<Mesh>& levels)
+{
+    lods.clear();
+    if (levels.empty() || levels[0].empty())
+    {
+        return false;
+    }
+
+    instanced = loadFunctions() && buildProgram();
+    if (instanced)
+    {
+        // per-instance positions, sized on every draw
+        pglGenBuffers(1, &instanceBuffer);
+    }
+    else
+    {
+        std::cerr << "SwarmRenderer: instancing unavailable, using display list fallback\n";
+    }
+
+    for (const Mesh& mesh : levels)
+    {
+        if (mesh.empty())
+        {
+            continue;
+        }
+        LodMesh lod = { 0, 0, static_cast<GLsizei>(mesh.indices.size()), 0, mesh.triangleCount() };
+        if (instanced)
+        {
+            // static mesh data, uploaded once
+            pglGenBuffers(1, &lod.vertexBuffer);
+            pglBindBuffer(GL_ARRAY_BUFFER, lod.vertexBuffer);
+            pglBufferData(GL_ARRAY_BUFFER, mesh.vertices.size() * sizeof(float),
+                          mesh.vertices.data(), GL_STATIC_DRAW);
+
+            pglGenBuffers(1, &lod.indexBuffer);
+            pglBindBuffer(GL_ELEMENT_ARRAY_BUFFER, lod.indexBuffer);
+            pglBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(uint32_t),
+                          mesh.indices.data(), GL_STATIC_DRAW);
+        }
+        else
+        {
+            // fallback: the mesh compiled once into a display list
+            lod.displayList = glGenLists(1);
+            glNewList(lod.displayList, GL_COMPILE);
+            glBegin(GL_TRIANGLES);
+            for (uint32_t index : mesh.indices)
+            {
+                const float* v = &mesh.vertices[index * Mesh::FLOATS_PER_VERTEX];
+                glNormal3f(v[3], v[4], v[5]);
+                glVertex3f(v[0], v[1], v[2]);
+            }
+            glEnd();
+            glEndList();
+            if (lod.displayList == 0)
+            {
+                return false;
+            }
+        }
+        lods.push_back(lod);
+    }
+
+    if (instanced)
+    {
+        pglBindBuffer(GL_ARRAY_BUFFER, 0);
+        pglBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+    return true;
+}
+
+void SwarmRenderer::draw(const std::vector<LodBatch>& levels)
+{
+    if (lods.empty())
+    {
+        return;
+    }
+    for (size_t l = 0; l < levels.size(); ++l)
+    {
+        if (levels[l].size() == 0)
+        {
+            continue;
+        }
+        const LodMesh& mesh = lods[std::min(l, lods.size() - 1)];
+        if (instanced)
+        {
+            drawLevel(mesh, levels[l]);
+        }
+        else
+        {
+            drawFallback(mesh, levels[l]);
+        }
+    }
+}
+
+void SwarmRenderer::drawLevel(const LodMesh& mesh, const LodBatch& batch)
+{
+    const size_t count = batch.size();
+
+    // instance buffer holds [x0..xn][y0..yn][z0..zn], straight from the SoA batch;
+    // reallocating (orphaning) each draw lets the driver avoid a sync stall
+    const GLsizeiptr axisBytes = static_cast<GLsizeiptr>(count * sizeof(float));
+    pglBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    pglBufferData(GL_ARRAY_BUFFER, axisBytes * 3, nullptr, GL_STREAM_DRAW);
+    pglBufferSubData(GL_ARRAY_BUFFER, 0, axisBytes, batch.x.data());
+    pglBufferSubData(GL_ARRAY_BUFFER, axisBytes, axisBytes, batch.y.data());
+    pglBufferSubData(GL_ARRAY_BUFFER, axisBytes * 2, axisBytes, batch.z.data());
+
+    const GLuint offsets[3] =
+    {
+        static_cast<GLuint>(offsetXLoc), static_cast<GLuint>(offsetYLoc), static_cast<GLuint>(offsetZLoc)
+    };
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        pglEnableVertexAttribArray(offsets[axis]);
+        pglVertexAttribPointer(offsets[axis], 1, GL_FLOAT, GL_FALSE, 0,
+                               reinterpret_cast<const GLvoid*>(axisBytes * axis));
+        pglVertexAttribDivisor(offsets[axis], 1);
+    }
+
+    // mesh attributes
+    const GLsizei stride = Mesh::FLOATS_PER_VERTEX * sizeof(float);
+    pglBindBuffer(GL_ARRAY_BUFFER, mesh.vertexBuffer);
+    pglEnableVertexAttribArray(ATTRIB_POSITION);
+    pglVertexAttribPointer(ATTRIB_POSITION, 3, GL_FLOAT, GL_FALSE, stride, nullptr);
+    pglEnableVertexAttribArray(ATTRIB_NORMAL);
+    pglVertexAttribPointer(ATTRIB_NORMAL, 3, GL_FLOAT, GL_FALSE, stride,
+                           reinterpret_cast<const GLvoid*>(3 * sizeof(float)));
+
+    pglBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.indexBuffer);
+    pglUseProgram(program);
+
+    // the whole level in one call
+    pglDrawElementsInstanced(GL_TRIANGLES, mesh.indexCount, GL_UNSIGNED_INT, nullptr,
+                             static_cast<GLsizei>(count));
+
+    // restore state for fixed-function drawing elsewhere
+    pglUseProgram(0);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        pglVertexAttribDivisor(offsets[axis], 0);
+        pglDisableVertexAttribArray(offsets[axis]);
+    }
+    pglDisableVertexAttribArray(ATTRIB_POSITION);
+    pglDisableVertexAttribArray(ATTRIB_NORMAL);
+    pglBindBuffer(GL_ARRAY_BUFFER, 0);
+    pglBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+// one display list call per UAV, geometry is still never re-tessellated
+void SwarmRenderer::drawFallback(const LodMesh& mesh, const LodBatch& batch)
+{
+    for (size_t i = 0; i < batch.size(); ++i)
+    {
+        glPushMatrix();
+        glTranslatef(batch.x[i], batch.y[i], batch.z[i]);
+        glCallList(mesh.displayList);
+        glPopMatrix();
+    }
+}
@@ -0,0 +1,66 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the swarm renderer. Every level of detail of the UAV
+mesh is uploaded once into GPU buffers; each frame the visible UAVs of each level
+(see cullSwarm in Frustum.h) are drawn with one instanced draw call, fed by a
+per-instance position buffer refreshed from the culled positions.
+*/
+
+#ifndef SWARM_RENDERER_H
+#define SWARM_RENDERER_H
+
+#include "Mesh.h"
+#include "Frustum.h"
+#include <GL/glut.h>
+#include <vector>
+
+class SwarmRenderer
+{
+public:
+    SwarmRenderer();
+    ~SwarmRenderer();
+
+    // upload the mesh levels (finest first), needs a current GL context;
+    // returns false if even the fallback path could not be set up
+    bool init(const std::vector<Mesh>& levels);
+
+    // one instance of level l's mesh at every position of levels[l] (batches
+    // past the last mesh level use the coarsest mesh)
+    void draw(const std::vector<LodBatch>& levels);
+
+    size_t levelCount() const { return lods.size(); }
+    size_t triangleCount(size_t level) const { return lods[level].triangles; }
+
+    // true when the single-call instanced path is active
+    bool isInstanced() const;
+
+private:
+    SwarmRenderer(const SwarmRenderer&);
+    SwarmRenderer& operator=(const SwarmRenderer&);
+
+    // GL objects of one mesh level
+    struct LodMesh
+    {
+        GLuint vertexBuffer;
+        GLuint indexBuffer;
+        GLsizei indexCount;
+        GLuint displayList; // fallback when instancing is unavailable
+        size_t triangles;
+    };
+
+    bool loadFunctions();
+    bool buildProgram();
+    void drawLevel(const LodMesh& mesh, const LodBatch& batch);
+    void drawFallback(const LodMesh& mesh, const LodBatch& batch);
+
+    bool instanced;
+    std::vector<LodMesh> lods;
+    GLuint instanceBuffer;
+
+    GLuint program;
+    GLint offsetXLoc, offsetYLoc, offsetZLoc;
+};
+
+#endif
@@ -0,0 +1,274 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the fixed-step swarm scheduler. Each tick is a
+pipeline of phases on a worker pool sized to the core count: target generation and
+SIMD integration over UAV chunks (with a neighbour query and steering pass in
+between when behaviours are on), the deterministic collision phase, then the
+snapshot copy.
+*/
+
+#include "SwarmScheduler.h"
+#include "SwarmKernels.h"
+#include "Profiler.h"
+#include "Trajectory.h"
+#include "MissionEngine.h"
+#include "SwarmBehaviours.h"
+#include "AsyncLog.h"
+#include <chrono>
+#include <cstring>
+
+// smallest chunk handed to a worker, keeps scheduling overhead low for small swarms
+static const size_t MIN_CHUNK = 64;
+
+// if stepping falls this many ticks behind, resync instead of bursting to catch up
+static const int MAX_CATCHUP_TICKS = 5;
+
+// size a snapshot frame for the swarm; only reallocates when UAVs were added
+// or removed since the frame was last written
+static void prepareFrame(const SwarmState& swarm, SwarmFrame& frame)
+{
+    if (frame.size() != swarm.size())
+    {
+        frame.resize(swarm.size());
+    }
+    frame.layout = swarm.layout;
+}
+
+// copy UAVs [begin, end) into a snapshot frame
+static void copyToFrame(const SwarmState& swarm, SwarmFrame& frame, size_t begin, size_t end)
+{
+    size_t bytes = (end - begin) * sizeof(float);
+    std::memcpy(&frame.posX[begin], &swarm.posX[begin], bytes);
+    std::memcpy(&frame.posY[begin], &swarm.posY[begin], bytes);
+    std::memcpy(&frame.posZ[begin], &swarm.posZ[begin], bytes);
+    std::memcpy(&frame.velX[begin], &swarm.velX[begin], bytes);
+    std::memcpy(&frame.velY[begin], &swarm.velY[begin], bytes);
+    std::memcpy(&frame.velZ[begin], &swarm.velZ[begin], bytes);
+}
+
+// constructor
+SwarmScheduler::SwarmScheduler(SwarmState& swarm, double tickSeconds, unsigned numWorkers,
+                               SwarmSnapshotBuffer* snapshots)
+    : swarm(swarm), snapshots(snapshots), tickSeconds(tickSeconds), chunkSize(MIN_CHUNK),
+      pool(numWorkers), collisionsEnabled(true), lastContacts(0), recorder(nullptr),
+      missions(nullptr), behaviours(nullptr), running(false), tickCount(0)
+{
+    // about four chunks per worker so faster workers can steal the tail
+    size_t perWorker = swarm.size() / (pool.size() * 4);
+    if (perWorker > chunkSize)
+    {
+        chunkSize = perWorker;
+    }
+
+    // whole SIMD iterations per chunk so only the last chunk has a scalar tail
+    size_t width = swarmKernelWidth();
+    chunkSize = (chunkSize + width - 1) / width * width;
+
+    // publish the initial state so the renderer has something to draw
+    if (snapshots)
+    {
+        SwarmFrame& frame = snapshots->writeFrame();
+        prepareFrame(swarm, frame);
+        copyToFrame(swarm, frame, 0, swarm.size());
+        frame.tick = 0;
+        frame.time = Profiler::now();
+        snapshots->publish();
+    }
+}
+
+// destructor: never leave the stepping thread running
+SwarmScheduler::~SwarmScheduler()
+{
+    stop();
+    join();
+}
+
+void SwarmScheduler::start()
+{
+    if (running.load())
+    {
+        return; // already running
+    }
+    join(); // reap a thread left over from an earlier stop()
+    running.store(true);
+    tickThread = std::thread(&SwarmScheduler::tickLoop, this);
+}
+
+void SwarmScheduler::stop()
+{
+    running.store(false);
+}
+
+void SwarmScheduler::join()
+{
+    if (tickThread.joinable())
+    {
+        tickThread.join();
+    }
+}
+
+// advance all UAVs one tick. Every chunk starts on a multiple of the SIMD width,
+// so each UAV takes the same kernel lanes whatever the worker count, and the
+// collision phase is order independent: ticks are bit-reproducible across
+// thread counts
+void SwarmScheduler::stepOnce()
+{
+    PROFILE_SCOPE("tick");
+    SwarmState& state = swarm;
+
+    // phase 1: targets, then PID + integration, both passes per chunk while it is in cache.
+    // Steering reads neighbours from other chunks, so with behaviours on every
+    // target is finished before any UAV moves
+    MissionEngine* plan = missions;
+    SwarmBehaviours* flock = behaviours;
+    auto targets = [&state, plan](size_t begin, size_t end)
+    {
+        if (plan)
+        {
+            missionTargetsRange(state, *plan, begin, end);
+        }
+        else
+        {
+            sphereTargetsRange(state, begin, end);
+        }
+    };
+    if (flock)
+    {
+        PROFILE_SCOPE("steer");
+        {
+            PROFILE_SCOPE("steer.index");
+            flock->buildIndex(state);
+        }
+        pool.parallelFor(state.size(), chunkSize, [&state, flock, &targets](size_t begin, size_t end, unsigned)
+        {
+            targets(begin, end);
+            flock->steerRange(state, begin, end);
+        });
+    }
+    {
+        PROFILE_SCOPE("integrate");
+        pool.parallelFor(state.size(), chunkSize, [&state, flock, &targets](size_t begin, size_t end, unsigned)
+        {
+            if (flock)
+            {
+                stepSwarmRange(state, begin, end);
+                flock->restoreRange(state, begin, end);
+            }
+            else
+            {
+                targets(begin, end);
+                stepSwarmRange(state, begin, end);
+            }
+        });
+    }
+
+    // phase 2: collisions (after integration, so no UAV is being stepped)
+    if (collisionsEnabled)
+    {
+        PROFILE_SCOPE("collisions");
+        lastContacts.store(handleCollisions(state, collisions, pool), std::memory_order_relaxed);
+    }
+
+    unsigned long long tick = tickCount.fetch_add(1, std::memory_order_release) + 1;
+
+    // encode into a recorder buffer, the file write happens on its own thread
+    if (recorder)
+    {
+        PROFILE_SCOPE("record");
+        if (!recorder->submit(state, tick) && tick % recorder->getTickInterval() == 0)
+        {
+            LOG_TEXT_EVERY(1.0, "Trajectory recorder behind, {} frames dropped so far",
+                           recorder->getFramesDropped());
+        }
+    }
+
+    // phase 3: publish for the renderer
+    if (snapshots)
+    {
+        PROFILE_SCOPE("snapshot");
+        SwarmFrame* frame = &snapshots->writeFrame();
+        prepareFrame(state, *frame);
+        pool.parallelFor(state.size(), chunkSize, [&state, frame](size_t begin, size_t end, unsigned)
+        {
+            copyToFrame(state, *frame, begin, end);
+        });
+        frame->tick = tick;
+        frame->time = Profiler::now();
+        snapshots->publish();
+    }
+}
+
+void SwarmScheduler::setBehaviours(SwarmBehaviours* flock)
+{
+    behaviours = flock;
+}
+
+void SwarmScheduler::setCollisionsEnabled(bool enabled)
+{
+    collisionsEnabled = enabled;
+}
+
+void SwarmScheduler::setRecorder(TrajectoryWriter* writer)
+{
+    recorder = writer;
+}
+
+void SwarmScheduler::setMissions(MissionEngine* plan, bool restart)
+{
+    missions = plan;
+    if (missions && restart)
+    {
+        missions->reset(swarm);
+    }
+}
+
+size_t SwarmScheduler::getLastContactCount() const
+{
+    return lastContacts.load(std::memory_order_relaxed);
+}
+
+bool SwarmScheduler::isRunning() const
+{
+    return running.load();
+}
+
+unsigned long long SwarmScheduler::getTickCount() const
+{
+    return tickCount.load(std::memory_order_acquire);
+}
+
+void SwarmScheduler::setTickCount(unsigned long long ticks)
+{
+    tickCount.store(ticks, std::memory_order_release);
+}
+
+unsigned SwarmScheduler::getWorkerCount() const
+{
+    return pool.size();
+}
+
+// stepping thread: one tick per period, paced against an absolute deadline so
+// scheduler jitter does not accumulate into timestep drift
+void SwarmScheduler::tickLoop()
+{
+    typedef std::chrono::steady_clock Clock;
+    const Clock::duration period = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(tickSeconds));
+
+    Clock::time_point next = Clock::now();
+
+    while (running.load())
+    {
+        stepOnce();
+
+        next += period;
+        Clock::time_point now = Clock::now();
+        if (now - next > period * MAX_CATCHUP_TICKS)
+        {
+            next = now; // too far behind, drop the backlog
+        }
+        std::this_thread::sleep_until(next);
+    }
+}
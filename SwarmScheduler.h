@@ -0,0 +1,92 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the fixed-step scheduler that advances the whole swarm in lockstep
+*/
+
+#ifndef SWARM_SCHEDULER_H
+#define SWARM_SCHEDULER_H
+
+#include "SwarmState.h"
+#include "WorkerPool.h"
+#include "SwarmSnapshot.h"
+#include "SwarmCollisions.h"
+#include <thread>
+#include <atomic>
+
+class TrajectoryWriter;
+class MissionEngine;
+class SwarmBehaviours;
+
+class SwarmScheduler
+{
+public:
+    // tickSeconds = physics period, numWorkers = 0 uses one worker per core,
+    // snapshots (optional) receives a copy of the swarm after every tick
+    SwarmScheduler(SwarmState& swarm, double tickSeconds = 0.01, unsigned numWorkers = 0,
+                   SwarmSnapshotBuffer* snapshots = nullptr);
+    ~SwarmScheduler();
+
+    // start stepping on a background thread at the fixed tick rate; after
+    // stop() it may be called again without an explicit join()
+    void start();
+
+    // ask the stepping thread to exit after the current tick
+    void stop();
+
+    // wait for the stepping thread to exit
+    void join();
+
+    // advance every UAV by exactly one tick on the calling thread + pool
+    void stepOnce();
+
+    // collision phase on/off (on by default), only change while stopped
+    void setCollisionsEnabled(bool enabled);
+
+    // record every tick to this writer (nullptr = off), only change while stopped
+    void setRecorder(TrajectoryWriter* recorder);
+
+    // fly these waypoint missions (nullptr = everyone orbits the sphere); restarts
+    // them from the first waypoint unless restart is false (progress restored
+    // from a checkpoint), only change while stopped
+    void setMissions(MissionEngine* missions, bool restart = true);
+
+    // flocking / formation keeping on top of the targets (nullptr = off), only
+    // change while stopped
+    void setBehaviours(SwarmBehaviours* behaviours);
+
+    bool isRunning() const;
+    unsigned long long getTickCount() const;
+
+    // carry on counting from a checkpoint's tick, only change while stopped
+    void setTickCount(unsigned long long ticks);
+    unsigned getWorkerCount() const;
+
+    // contacts resolved during the most recent tick
+    size_t getLastContactCount() const;
+
+private:
+    SwarmScheduler(const SwarmScheduler&);
+    SwarmScheduler& operator=(const SwarmScheduler&);
+
+    void tickLoop();
+
+    SwarmState& swarm;
+    SwarmSnapshotBuffer* snapshots;
+    double tickSeconds;
+    size_t chunkSize;
+
+    WorkerPool pool;
+    CollisionWorkspace collisions;
+    bool collisionsEnabled;
+    std::atomic<size_t> lastContacts;
+    TrajectoryWriter* recorder;
+    MissionEngine* missions;
+    SwarmBehaviours* behaviours;
+    std::thread tickThread;
+    std::atomic<bool> running;
+    std::atomic<unsigned long long> tickCount;
+};
+
+#endif
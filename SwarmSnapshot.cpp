@@ -0,0 +1,129 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the lock-free triple-buffered swarm snapshot and
+its interpolating reader
+*/
+
+#include "SwarmSnapshot.h"
+#include <utility>
+
+// weight of a new frame gap in the smoothed sampling delay
+static const double DELAY_SMOOTHING = 0.1;
+
+void SwarmFrame::resize(size_t count)
+{
+    posX.assign(count, 0.0f);
+    posY.assign(count, 0.0f);
+    posZ.assign(count, 0.0f);
+    velX.assign(count, 0.0f);
+    velY.assign(count, 0.0f);
+    velZ.assign(count, 0.0f);
+    tick = 0;
+    time = 0;
+    layout = 0;
+}
+
+// constructor: writer owns 0, middle holds 1, reader owns 2
+SwarmSnapshotBuffer::SwarmSnapshotBuffer(size_t count)
+    : middle(1), back(0), front(2)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        frames[i].resize(count);
+    }
+}
+
+SwarmFrame& SwarmSnapshotBuffer::writeFrame()
+{
+    return frames[back];
+}
+
+// hand the back buffer to the middle slot and take the old middle as new back
+void SwarmSnapshotBuffer::publish()
+{
+    unsigned prev = middle.exchange(back | FRESH_BIT, std::memory_order_acq_rel);
+    back = prev & INDEX_MASK;
+}
+
+// if the middle slot holds an unread frame, swap it with the front buffer
+const SwarmFrame& SwarmSnapshotBuffer::readFrame()
+{
+    if (middle.load(std::memory_order_relaxed) & FRESH_BIT)
+    {
+        unsigned prev = middle.exchange(front, std::memory_order_acq_rel);
+        front = prev & INDEX_MASK;
+    }
+    return frames[front];
+}
+
+bool SwarmSnapshotBuffer::hasNewFrame() const
+{
+    return (middle.load(std::memory_order_relaxed) & FRESH_BIT) != 0;
+}
+
+SwarmInterpolator::SwarmInterpolator() : delay(0)
+{
+}
+
+// the two history frames are swapped, not reallocated, so a new frame costs
+// one copy of the positions and velocities
+void SwarmInterpolator::update(SwarmSnapshotBuffer& buffer)
+{
+    const SwarmFrame& latest = buffer.readFrame();
+    if (newer.size() == latest.size() && latest.tick == newer.tick)
+    {
+        return;
+    }
+
+    std::swap(older, newer);
+    newer = latest;
+    if (older.size() != newer.size() || older.layout != newer.layout)
+    {
+        older = newer; // first frame (or UAVs were added or removed), nothing to blend
+        return;
+    }
+
+    uint64_t gap = newer.time - older.time;
+    delay = (delay == 0) ? gap : static_cast<uint64_t>(delay + DELAY_SMOOTHING * (static_cast<double>(gap) - delay));
+}
+
+const SwarmFrame& SwarmInterpolator::sample(uint64_t now)
+{
+    uint64_t at = now - delay;
+    if (older.tick == newer.tick || at >= newer.time)
+    {
+        return newer;
+    }
+    if (at <= older.time)
+    {
+        return older;
+    }
+
+    const float t = static_cast<float>(static_cast<double>(at - older.time) / (newer.time - older.time));
+    const size_t count = newer.size();
+    blended.posX.resize(count);
+    blended.posY.resize(count);
+    blended.posZ.resize(count);
+    blended.velX.resize(count);
+    blended.velY.resize(count);
+    blended.velZ.resize(count);
+
+    const std::vector<float>* from[6] = { &older.posX, &older.posY, &older.posZ, &older.velX, &older.velY, &older.velZ };
+    const std::vector<float>* to[6] = { &newer.posX, &newer.posY, &newer.posZ, &newer.velX, &newer.velY, &newer.velZ };
+    std::vector<float>* out[6] = { &blended.posX, &blended.posY, &blended.posZ, &blended.velX, &blended.velY, &blended.velZ };
+    for (int a = 0; a < 6; ++a)
+    {
+        const float* x0 = from[a]->data();
+        const float* x1 = to[a]->data();
+        float* y = out[a]->data();
+        for (size_t i = 0; i < count; ++i)
+        {
+            y[i] = x0[i] + (x1[i] - x0[i]) * t;
+        }
+    }
+    blended.tick = older.tick;
+    blended.time = at;
+    return blended;
+}
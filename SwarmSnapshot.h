@@ -0,0 +1,90 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the triple-buffered swarm snapshot shared between the
+physics writer and the renderer. Neither side ever blocks the other: the writer
+fills a private back buffer and publishes it with one atomic exchange, and the
+reader picks up the newest published buffer the same way. SwarmInterpolator sits
+on the reader side and blends the last two frames, so the render rate does not
+have to match the physics tick rate.
+*/
+
+#ifndef SWARM_SNAPSHOT_H
+#define SWARM_SNAPSHOT_H
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// one published copy of the swarm state
+struct SwarmFrame
+{
+    std::vector<float> posX, posY, posZ;
+    std::vector<float> velX, velY, velZ;
+    unsigned long long tick;
+    uint64_t time;   // when it was published, Profiler::now() clock (ns)
+    uint64_t layout; // SwarmState::layout, frames with the same one can be blended
+
+    void resize(size_t count);
+    size_t size() const { return posX.size(); }
+};
+
+// single writer / single reader triple buffer
+class SwarmSnapshotBuffer
+{
+public:
+    explicit SwarmSnapshotBuffer(size_t count);
+
+    // writer side: fill the back frame then publish it
+    SwarmFrame& writeFrame();
+    void publish();
+
+    // reader side: newest published frame (unchanged if nothing new arrived)
+    const SwarmFrame& readFrame();
+
+    // true if a frame was published since the last readFrame()
+    bool hasNewFrame() const;
+
+private:
+    SwarmSnapshotBuffer(const SwarmSnapshotBuffer&);
+    SwarmSnapshotBuffer& operator=(const SwarmSnapshotBuffer&);
+
+    static const unsigned FRESH_BIT = 4;
+    static const unsigned INDEX_MASK = 3;
+
+    SwarmFrame frames[3];
+
+    // index of the buffer in the middle slot, FRESH_BIT set when unread
+    std::atomic<unsigned> middle;
+
+    unsigned back;  // owned by the writer
+    unsigned front; // owned by the reader
+};
+
+// reader side: keeps the last two frames seen and samples positions in
+// between. Sampling happens one (smoothed) frame gap in the past, so there is
+// always a newer frame to blend toward whether physics runs faster or slower
+// than the renderer; the cost is that much display latency. Frames from either
+// side of a UAV launch or landing are not blended (indices changed owners)
+class SwarmInterpolator
+{
+public:
+    SwarmInterpolator();
+
+    // take the newest published frame, if it is newer than the last one
+    void update(SwarmSnapshotBuffer& buffer);
+
+    // swarm as of now minus the frame gap, blended per UAV
+    const SwarmFrame& sample(uint64_t now);
+
+    // current sampling delay (ns)
+    uint64_t getDelay() const { return delay; }
+
+private:
+    SwarmFrame older, newer, blended;
+    uint64_t delay;
+};
+
+#endif
@@ -0,0 +1,150 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the structure-of-arrays swarm container
+*/
+
+#include "SwarmState.h"
+
+const char* integratorName(int integrator)
+{
+    static const char* names[NUM_INTEGRATORS] = { "euler", "verlet", "rk4", "adaptive" };
+    return (integrator >= 0 && integrator < NUM_INTEGRATORS) ? names[integrator] : "unknown";
+}
+
+// constructor: convert array-of-structs UAVs into SoA
+SwarmState::SwarmState(const std::vector<ECE_UAV>& uavs)
+    : layout(0)
+{
+    if (!uavs.empty())
+    {
+        // physical constants are swarm wide, take them from the first UAV
+        const ECE_UAV& first = uavs[0];
+        params.mass = static_cast<float>(first.mass);
+        params.maxForcePerAxis = static_cast<float>(first.maxForcePerAxis);
+        params.dragCoeff = static_cast<float>(first.dragCoeff);
+
+        params.kpX = static_cast<float>(first.pidX.Kp);
+        params.kiX = static_cast<float>(first.pidX.Ki);
+        params.kdX = static_cast<float>(first.pidX.Kd);
+        params.kpY = static_cast<float>(first.pidY.Kp);
+        params.kiY = static_cast<float>(first.pidY.Ki);
+        params.kdY = static_cast<float>(first.pidY.Kd);
+        params.kpZ = static_cast<float>(first.pidZ.Kp);
+        params.kiZ = static_cast<float>(first.pidZ.Ki);
+        params.kdZ = static_cast<float>(first.pidZ.Kd);
+    }
+
+    reserve(uavs.size());
+    for (const auto& uav : uavs)
+    {
+        addUAV(uav.pos.x, uav.pos.y, uav.pos.z);
+
+        velX.back() = uav.vel.x;
+        velY.back() = uav.vel.y;
+        velZ.back() = uav.vel.z;
+        accX.back() = uav.acc.x;
+        accY.back() = uav.acc.y;
+        accZ.back() = uav.acc.z;
+
+        integralX.back() = static_cast<float>(uav.pidX.integral);
+        integralY.back() = static_cast<float>(uav.pidY.integral);
+        integralZ.back() = static_cast<float>(uav.pidZ.integral);
+        lastErrorX.back() = static_cast<float>(uav.pidX.lastError);
+        lastErrorY.back() = static_cast<float>(uav.pidY.lastError);
+        lastErrorZ.back() = static_cast<float>(uav.pidZ.lastError);
+    }
+}
+
+void SwarmState::addUAV(float x, float y, float z)
+{
+    posX.push_back(x);
+    posY.push_back(y);
+    posZ.push_back(z);
+
+    velX.push_back(0.0f);
+    velY.push_back(0.0f);
+    velZ.push_back(0.0f);
+    accX.push_back(0.0f);
+    accY.push_back(0.0f);
+    accZ.push_back(0.0f);
+
+    integralX.push_back(0.0f);
+    integralY.push_back(0.0f);
+    integralZ.push_back(0.0f);
+    lastErrorX.push_back(0.0f);
+    lastErrorY.push_back(0.0f);
+    lastErrorZ.push_back(0.0f);
+
+    // refreshed before the first step
+    targetX.push_back(params.centerX);
+    targetY.push_back(params.centerY);
+    targetZ.push_back(params.centerZ + params.radius);
+    ++layout;
+}
+
+void SwarmState::removeUAV(size_t index)
+{
+    const size_t last = size() - 1;
+    for (size_t a = 0; a < NUM_ARRAYS; ++a)
+    {
+        FloatArray& values = array(a);
+        values[index] = values[last];
+        values.resize(last);
+    }
+    ++layout;
+}
+
+void SwarmState::reserve(size_t count)
+{
+    for (size_t a = 0; a < NUM_ARRAYS; ++a)
+    {
+        array(a).reserve(count);
+    }
+}
+
+void SwarmState::clear()
+{
+    for (size_t a = 0; a < NUM_ARRAYS; ++a)
+    {
+        array(a).clear();
+    }
+    ++layout;
+}
+
+FloatArray& SwarmState::array(size_t index)
+{
+    // member pointers, so the table is built once rather than on every call
+    static FloatArray SwarmState::* const arrays[NUM_ARRAYS] =
+    {
+        &SwarmState::posX, &SwarmState::posY, &SwarmState::posZ,
+        &SwarmState::velX, &SwarmState::velY, &SwarmState::velZ,
+        &SwarmState::accX, &SwarmState::accY, &SwarmState::accZ,
+        &SwarmState::integralX, &SwarmState::integralY, &SwarmState::integralZ,
+        &SwarmState::lastErrorX, &SwarmState::lastErrorY, &SwarmState::lastErrorZ,
+        &SwarmState::targetX, &SwarmState::targetY, &SwarmState::targetZ
+    };
+    return this->*arrays[index];
+}
+
+const FloatArray& SwarmState::array(size_t index) const
+{
+    return const_cast<SwarmState*>(this)->array(index);
+}
+
+void SwarmState::copyTo(std::vector<ECE_UAV>& uavs) const
+{
+    for (size_t i = 0; i < uavs.size() && i < size(); ++i)
+    {
+        uavs[i].pos.x = posX[i];
+        uavs[i].pos.y = posY[i];
+        uavs[i].pos.z = posZ[i];
+        uavs[i].vel.x = velX[i];
+        uavs[i].vel.y = velY[i];
+        uavs[i].vel.z = velZ[i];
+        uavs[i].acc.x = accX[i];
+        uavs[i].acc.y = accY[i];
+        uavs[i].acc.z = accZ[i];
+    }
+}
@@ -0,0 +1,161 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Structure-of-arrays container for the whole swarm. Every per-UAV field
+lives in its own contiguous, 32-byte aligned array so the stepping kernels can
+load 4 or 8 UAVs per SIMD register.
+*/
+
+#ifndef SWARM_STATE_H
+#define SWARM_STATE_H
+
+#include "ECE_UAV.h"
+#include <vector>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// allocator returning Align-byte aligned storage for SIMD loads
+template <typename T, size_t Align>
+struct AlignedAllocator
+{
+    typedef T value_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef AlignedAllocator<U, Align> other;
+    };
+
+    AlignedAllocator() {}
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Align>&) {}
+
+    T* allocate(size_t n)
+    {
+        void* p = nullptr;
+#ifdef _WIN32
+        p = _aligned_malloc(n * sizeof(T), Align);
+#else
+        if (posix_memalign(&p, Align, n * sizeof(T)) != 0)
+        {
+            p = nullptr;
+        }
+#endif
+        if (!p)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t)
+    {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        free(p);
+#endif
+    }
+};
+
+template <typename T, typename U, size_t Align>
+bool operator==(const AlignedAllocator<T, Align>&, const AlignedAllocator<U, Align>&) { return true; }
+template <typename T, typename U, size_t Align>
+bool operator!=(const AlignedAllocator<T, Align>&, const AlignedAllocator<U, Align>&) { return false; }
+
+typedef std::vector<float, AlignedAllocator<float, 32> > FloatArray;
+
+// how the stepping kernels advance a tick (see SwarmKernels.cpp)
+enum SwarmIntegrator
+{
+    INTEGRATOR_EULER,    // semi-implicit Euler, one evaluation
+    INTEGRATOR_VERLET,   // velocity Verlet, two evaluations
+    INTEGRATOR_RK4,      // classic Runge-Kutta, four evaluations
+    INTEGRATOR_ADAPTIVE, // Bogacki-Shampine 3(2) substeps held to params.tolerance
+    NUM_INTEGRATORS
+};
+
+// "euler", "verlet", "rk4", "adaptive"
+const char* integratorName(int integrator);
+
+// physics constants and gains shared by every UAV in the swarm
+struct SwarmParams
+{
+    float dt;
+    float gravity;
+    float mass;
+    float maxForcePerAxis;
+    float dragCoeff;
+    float collisionDistance;
+
+    // SwarmIntegrator, and the local error allowed per adaptive substep (m)
+    int integrator;
+    float tolerance;
+
+    // default target: the closest point on this sphere (UAVs without a mission)
+    float centerX, centerY, centerZ;
+    float radius;
+
+    // position PID gains per axis
+    float kpX, kiX, kdX;
+    float kpY, kiY, kdY;
+    float kpZ, kiZ, kdZ;
+
+    // defaults match the ECE_UAV constructor and applyPIDControl()
+    SwarmParams()
+        : dt(0.01f), gravity(-10.0f), mass(1.0f), maxForcePerAxis(20.0f), dragCoeff(0.05f),
+          collisionDistance(UAV_COLLISION_DISTANCE), integrator(INTEGRATOR_EULER), tolerance(1e-4f),
+          centerX(0.0f), centerY(0.0f), centerZ(50.0f), radius(10.0f),
+          kpX(4.0f), kiX(0.2f), kdX(2.0f),
+          kpY(4.0f), kiY(0.2f), kdY(2.0f),
+          kpZ(5.0f), kiZ(0.3f), kdZ(2.5f) {}
+};
+
+class SwarmState
+{
+public:
+    SwarmParams params;
+
+    // kinematics
+    FloatArray posX, posY, posZ;
+    FloatArray velX, velY, velZ;
+    FloatArray accX, accY, accZ;
+
+    // position PID controller state
+    FloatArray integralX, integralY, integralZ;
+    FloatArray lastErrorX, lastErrorY, lastErrorZ;
+
+    // position the controller steers toward this tick (sphere or mission waypoint)
+    FloatArray targetX, targetY, targetZ;
+
+    // bumped whenever a UAV is added or removed; while it is unchanged, index i
+    // names the same UAV
+    unsigned long long layout;
+
+    SwarmState() : layout(0) {}
+
+    // copy positions, velocities and controller state out of ECE_UAV objects
+    explicit SwarmState(const std::vector<ECE_UAV>& uavs);
+
+    // add one UAV at rest
+    void addUAV(float x, float y, float z);
+
+    // remove UAV index by moving the last UAV into its place (order not kept)
+    void removeUAV(size_t index);
+
+    void reserve(size_t count);
+    void clear();
+    size_t size() const { return posX.size(); }
+
+    // write positions and velocities back into ECE_UAV objects (same order)
+    void copyTo(std::vector<ECE_UAV>& uavs) const;
+
+    // every per-UAV array, in declaration order, for bulk operations
+    enum { NUM_ARRAYS = 18 };
+    FloatArray& array(size_t index);
+    const FloatArray& array(size_t index) const;
+};
+
+#endif
@@ -0,0 +1,395 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the trajectory recorder and reader
+*/
+
+#include "Trajectory.h"
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+
+static const char TRAJECTORY_MAGIC[4] = { 'U', 'A', 'V', 'T' };
+static const uint32_t TRAJECTORY_VERSION = 2; // 1 = fixed count only, still read
+
+// how long the writer thread sleeps when there is nothing to write
+static const int WRITER_IDLE_MS = 1;
+
+TrajectoryOptions::TrajectoryOptions()
+    : quantized(false), variableCount(false), tickInterval(1), bufferFrames(64), maxSpeed(50.0f)
+{
+    // field plus a margin, 0.5 cm resolution at 16 bits
+    boundsMin[0] = -150.0f; boundsMin[1] = -100.0f; boundsMin[2] = 0.0f;
+    boundsMax[0] = 200.0f;  boundsMax[1] = 200.0f;  boundsMax[2] = 300.0f;
+}
+
+// tick, then (variable count) the frame's UAV count, 8 bytes each
+static size_t frameHeadBytes(uint32_t flags)
+{
+    return sizeof(uint64_t) + ((flags & TRAJECTORY_VARIABLE_COUNT) ? sizeof(uint64_t) : 0);
+}
+
+// bytes per frame: head + six arrays, padded so frames stay 8-byte aligned
+static size_t frameBytesFor(size_t uavCount, uint32_t flags)
+{
+    const bool quantized = (flags & TRAJECTORY_QUANTIZED) != 0;
+    size_t bytes = frameHeadBytes(flags) + uavCount * 6 * (quantized ? sizeof(uint16_t) : sizeof(float));
+    return (bytes + 7) & ~static_cast<size_t>(7);
+}
+
+static uint16_t quantizePos(float value, float origin, float invScale)
+{
+    float q = (value - origin) * invScale + 0.5f;
+    if (q < 0.0f) q = 0.0f;
+    if (q > 65535.0f) q = 65535.0f;
+    return static_cast<uint16_t>(q);
+}
+
+static int16_t quantizeVel(float value, float invScale)
+{
+    float q = value * invScale;
+    q += (q < 0.0f) ? -0.5f : 0.5f;
+    if (q < -32767.0f) q = -32767.0f;
+    if (q > 32767.0f) q = 32767.0f;
+    return static_cast<int16_t>(q);
+}
+
+// write one frame of the live swarm into out (frameBytesFor its size)
+static void encodeFrame(const TrajectoryHeader& header, const SwarmState& swarm, uint64_t tick, char* out)
+{
+    const size_t n = swarm.size();
+    std::memcpy(out, &tick, sizeof(tick));
+    if (header.flags & TRAJECTORY_VARIABLE_COUNT)
+    {
+        const uint64_t count = n;
+        std::memcpy(out + sizeof(tick), &count, sizeof(count));
+    }
+    char* payload = out + frameHeadBytes(header.flags);
+
+    const float* arrays[6] = { swarm.posX.data(), swarm.posY.data(), swarm.posZ.data(),
+                               swarm.velX.data(), swarm.velY.data(), swarm.velZ.data() };
+
+    if (!(header.flags & TRAJECTORY_QUANTIZED))
+    {
+        for (int a = 0; a < 6; ++a)
+        {
+            std::memcpy(payload + a * n * sizeof(float), arrays[a], n * sizeof(float));
+        }
+        return;
+    }
+
+    for (int a = 0; a < 3; ++a)
+    {
+        uint16_t* q = reinterpret_cast<uint16_t*>(payload) + a * n;
+        const float origin = header.posOrigin[a];
+        const float invScale = 1.0f / header.posScale[a];
+        for (size_t i = 0; i < n; ++i)
+        {
+            q[i] = quantizePos(arrays[a][i], origin, invScale);
+        }
+    }
+    const float invVel = 1.0f / header.velScale;
+    for (int a = 3; a < 6; ++a)
+    {
+        int16_t* q = reinterpret_cast<int16_t*>(payload) + a * n;
+        for (size_t i = 0; i < n; ++i)
+        {
+            q[i] = quantizeVel(arrays[a][i], invVel);
+        }
+    }
+}
+
+// ---- SpscIndexQueue ----
+
+void SpscIndexQueue::reset(size_t capacity)
+{
+    slots.assign(capacity + 1, 0); // one slot stays empty to tell full from empty
+    head.store(0);
+    tail.store(0);
+}
+
+bool SpscIndexQueue::push(uint32_t value)
+{
+    size_t t = tail.load(std::memory_order_relaxed);
+    size_t next = (t + 1) % slots.size();
+    if (next == head.load(std::memory_order_acquire))
+    {
+        return false; // full
+    }
+    slots[t] = value;
+    tail.store(next, std::memory_order_release);
+    return true;
+}
+
+bool SpscIndexQueue::pop(uint32_t& value)
+{
+    size_t h = head.load(std::memory_order_relaxed);
+    if (h == tail.load(std::memory_order_acquire))
+    {
+        return false; // empty
+    }
+    value = slots[h];
+    head.store((h + 1) % slots.size(), std::memory_order_release);
+    return true;
+}
+
+// ---- TrajectoryWriter ----
+
+TrajectoryWriter::TrajectoryWriter()
+    : file(nullptr), tickInterval(1), peakCount(0), stopping(false), writeFailed(false),
+      framesWritten(0), framesDropped(0)
+{
+    std::memset(&header, 0, sizeof(header));
+}
+
+TrajectoryWriter::~TrajectoryWriter()
+{
+    close();
+}
+
+bool TrajectoryWriter::open(const std::string& path, size_t uavCount, double dt, const TrajectoryOptions& options)
+{
+    close();
+
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, TRAJECTORY_MAGIC, 4);
+    header.version = TRAJECTORY_VERSION;
+    header.flags = (options.quantized ? TRAJECTORY_QUANTIZED : 0)
+                   | (options.variableCount ? TRAJECTORY_VARIABLE_COUNT : 0);
+    header.uavCount = static_cast<uint32_t>(uavCount);
+    header.frameBytes = options.variableCount ? 0 : static_cast<uint32_t>(frameBytesFor(uavCount, header.flags));
+    header.tickInterval = (options.tickInterval > 0) ? options.tickInterval : 1;
+    header.dt = dt;
+    for (int a = 0; a < 3; ++a)
+    {
+        header.posOrigin[a] = options.boundsMin[a];
+        header.posScale[a] = (options.boundsMax[a] - options.boundsMin[a]) / 65535.0f;
+    }
+    header.velScale = options.maxSpeed / 32767.0f;
+
+    file = std::fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        return false;
+    }
+    if (std::fwrite(&header, sizeof(header), 1, file) != 1)
+    {
+        std::fclose(file);
+        file = nullptr;
+        return false;
+    }
+
+    tickInterval = header.tickInterval;
+    peakCount = 0;
+    size_t poolSize = (options.bufferFrames > 0) ? options.bufferFrames : 1;
+    buffers.assign(poolSize, std::vector<char>(frameBytesFor(uavCount, header.flags), 0));
+    freeBuffers.reset(poolSize);
+    filledBuffers.reset(poolSize);
+    for (size_t i = 0; i < poolSize; ++i)
+    {
+        freeBuffers.push(static_cast<uint32_t>(i));
+    }
+
+    stopping.store(false);
+    writeFailed.store(false);
+    framesWritten.store(0);
+    framesDropped.store(0);
+    writerThread = std::thread(&TrajectoryWriter::writerLoop, this);
+    return true;
+}
+
+bool TrajectoryWriter::submit(const SwarmState& swarm, unsigned long long tick)
+{
+    const bool variable = (header.flags & TRAJECTORY_VARIABLE_COUNT) != 0;
+    if (!file || tick % tickInterval != 0 || (!variable && swarm.size() != header.uavCount))
+    {
+        return false;
+    }
+
+    uint32_t index;
+    if (!freeBuffers.pop(index))
+    {
+        framesDropped.fetch_add(1, std::memory_order_relaxed); // writer behind, never wait
+        return false;
+    }
+    // only grows past the size given to open() if the swarm does
+    buffers[index].resize(frameBytesFor(swarm.size(), header.flags));
+    encodeFrame(header, swarm, tick, buffers[index].data());
+    filledBuffers.push(index);
+    peakCount = std::max(peakCount, swarm.size());
+    return true;
+}
+
+void TrajectoryWriter::writerLoop()
+{
+    while (true)
+    {
+        // read the flag first: anything pushed before close() is then still popped
+        bool done = stopping.load();
+
+        uint32_t index;
+        if (filledBuffers.pop(index))
+        {
+            if (std::fwrite(buffers[index].data(), buffers[index].size(), 1, file) == 1)
+            {
+                framesWritten.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                writeFailed.store(true);
+            }
+            freeBuffers.push(index);
+            continue;
+        }
+        if (done)
+        {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(WRITER_IDLE_MS));
+    }
+}
+
+bool TrajectoryWriter::close()
+{
+    if (!file)
+    {
+        return false;
+    }
+
+    stopping.store(true);
+    if (writerThread.joinable())
+    {
+        writerThread.join();
+    }
+
+    // the frame count lets readers detect a truncated recording
+    header.frameCount = framesWritten.load();
+    if (header.flags & TRAJECTORY_VARIABLE_COUNT)
+    {
+        header.uavCount = static_cast<uint32_t>(peakCount);
+    }
+    bool ok = !writeFailed.load() && std::fseek(file, 0, SEEK_SET) == 0
+           && std::fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = (std::fclose(file) == 0) && ok;
+    file = nullptr;
+    buffers.clear();
+    return ok;
+}
+
+// ---- TrajectoryReader ----
+
+TrajectoryReader::TrajectoryReader()
+    : frames(0)
+{
+    std::memset(&header, 0, sizeof(header));
+}
+
+bool TrajectoryReader::open(const std::string& path)
+{
+    close();
+    if (!file.open(path) || file.size() < sizeof(TrajectoryHeader))
+    {
+        file.close();
+        return false;
+    }
+
+    std::memcpy(&header, file.data(), sizeof(header));
+    const bool variable = (header.flags & TRAJECTORY_VARIABLE_COUNT) != 0;
+    if (std::memcmp(header.magic, TRAJECTORY_MAGIC, 4) != 0 || header.version < 1
+        || header.version > TRAJECTORY_VERSION || (variable && header.version < 2)
+        || (variable ? header.frameBytes != 0
+                     : header.uavCount == 0 || header.frameBytes != frameBytesFor(header.uavCount, header.flags)))
+    {
+        file.close();
+        return false;
+    }
+
+    // whole frames actually on disk (a recording cut short still replays)
+    const uint64_t limit = (header.frameCount > 0) ? header.frameCount : ~0ull;
+    if (!variable)
+    {
+        frames = (file.size() - sizeof(header)) / header.frameBytes;
+        frames = static_cast<size_t>(std::min<uint64_t>(frames, limit));
+        return frames > 0;
+    }
+
+    // variable count: walk the frame heads once to find every frame
+    uint64_t offset = sizeof(header);
+    const size_t headBytes = frameHeadBytes(header.flags);
+    while (frameOffsets.size() < limit && file.size() - offset >= headBytes)
+    {
+        uint64_t count;
+        std::memcpy(&count, file.data() + offset + sizeof(uint64_t), sizeof(count));
+        const uint64_t maxCount = (file.size() - offset) / (6 * sizeof(uint16_t));
+        if (count > maxCount || frameBytesFor(static_cast<size_t>(count), header.flags) > file.size() - offset)
+        {
+            break;
+        }
+        frameOffsets.push_back(offset);
+        offset += frameBytesFor(static_cast<size_t>(count), header.flags);
+    }
+    frames = frameOffsets.size();
+    return frames > 0;
+}
+
+void TrajectoryReader::close()
+{
+    file.close();
+    frames = 0;
+    frameOffsets.clear();
+}
+
+bool TrajectoryReader::readFrame(size_t index, SwarmFrame& out) const
+{
+    if (index >= frames)
+    {
+        return false;
+    }
+
+    const bool variable = (header.flags & TRAJECTORY_VARIABLE_COUNT) != 0;
+    const char* frame = file.data() + (variable ? frameOffsets[index] : sizeof(header) + index * header.frameBytes);
+    const char* payload = frame + frameHeadBytes(header.flags);
+
+    uint64_t tick;
+    std::memcpy(&tick, frame, sizeof(tick));
+    uint64_t count = header.uavCount;
+    if (variable)
+    {
+        std::memcpy(&count, frame + sizeof(tick), sizeof(count));
+    }
+    const size_t n = static_cast<size_t>(count);
+    out.resize(n);
+    out.tick = tick;
+
+    float* arrays[6] = { out.posX.data(), out.posY.data(), out.posZ.data(),
+                         out.velX.data(), out.velY.data(), out.velZ.data() };
+
+    if (!(header.flags & TRAJECTORY_QUANTIZED))
+    {
+        for (int a = 0; a < 6; ++a)
+        {
+            std::memcpy(arrays[a], payload + a * n * sizeof(float), n * sizeof(float));
+        }
+        return true;
+    }
+
+    for (int a = 0; a < 3; ++a)
+    {
+        const uint16_t* q = reinterpret_cast<const uint16_t*>(payload) + a * n;
+        for (size_t i = 0; i < n; ++i)
+        {
+            arrays[a][i] = header.posOrigin[a] + q[i] * header.posScale[a];
+        }
+    }
+    for (int a = 3; a < 6; ++a)
+    {
+        const int16_t* q = reinterpret_cast<const int16_t*>(payload) + a * n;
+        for (size_t i = 0; i < n; ++i)
+        {
+            arrays[a][i] = q[i] * header.velScale;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,154 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the binary flight-trajectory format. A file is one
+TrajectoryHeader followed by fixed-size frames (tick, then positions and
+velocities as SoA arrays), so frame i is at a computable offset and replay can
+seek anywhere in a memory-mapped file. Frames are raw floats or, optionally,
+quantized to 16 bits per component (half the size). A swarm that grows and
+shrinks while recording (SwarmPool) is written with TRAJECTORY_VARIABLE_COUNT:
+every frame then carries its own UAV count and is only as long as it needs,
+and the reader indexes the frames once when it opens the file.
+
+TrajectoryWriter records from the simulation thread without blocking it: frames
+are encoded into buffers from a fixed pool and handed to a background thread
+that writes them out. If the writer falls behind and the pool is empty, frames
+are dropped (and counted) instead of stalling the tick.
+*/
+
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+
+#include "SwarmState.h"
+#include "SwarmSnapshot.h"
+#include "MappedFile.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+
+static const uint32_t TRAJECTORY_QUANTIZED = 1;
+static const uint32_t TRAJECTORY_VARIABLE_COUNT = 2;
+
+struct TrajectoryHeader
+{
+    char magic[4];          // "UAVT"
+    uint32_t version;
+    uint32_t flags;         // TRAJECTORY_QUANTIZED, TRAJECTORY_VARIABLE_COUNT
+    uint32_t uavCount;      // per frame; the most in any frame if the count varies
+    uint32_t frameBytes;    // size of every frame including the tick, 0 if the count varies
+    uint32_t tickInterval;  // simulation ticks between recorded frames
+    double dt;              // simulation tick length in seconds
+    uint64_t frameCount;    // written on close, 0 if the recorder never closed
+    float posOrigin[3];     // quantized position = origin + q * scale
+    float posScale[3];
+    float velScale;         // quantized velocity = q * scale
+    uint32_t reserved;
+};
+
+// recording settings
+struct TrajectoryOptions
+{
+    bool quantized;
+    bool variableCount;     // UAVs may be added and removed while recording
+    unsigned tickInterval;  // record every Nth tick
+    size_t bufferFrames;    // frames that can be queued for the writer thread
+    float boundsMin[3];     // quantization range for positions
+    float boundsMax[3];
+    float maxSpeed;         // quantization range for velocities
+
+    TrajectoryOptions();
+};
+
+// lock-free queue of buffer indices, one producer thread and one consumer thread
+class SpscIndexQueue
+{
+public:
+    SpscIndexQueue() : head(0), tail(0) {}
+
+    void reset(size_t capacity);
+    bool push(uint32_t value);
+    bool pop(uint32_t& value);
+
+private:
+    std::vector<uint32_t> slots;
+    std::atomic<size_t> head; // next pop (consumer)
+    std::atomic<size_t> tail; // next push (producer)
+};
+
+class TrajectoryWriter
+{
+public:
+    TrajectoryWriter();
+    ~TrajectoryWriter();
+
+    // create the file and start the writer thread; with a variable count,
+    // uavCount is the most UAVs the buffers are sized for up front
+    bool open(const std::string& path, size_t uavCount, double dt,
+              const TrajectoryOptions& options = TrajectoryOptions());
+
+    // record the swarm if tick is on the recording interval; never blocks,
+    // returns false if the frame had to be dropped
+    bool submit(const SwarmState& swarm, unsigned long long tick);
+
+    // drain queued frames, finish the header and close the file
+    bool close();
+
+    bool isOpen() const { return file != nullptr; }
+    unsigned getTickInterval() const { return tickInterval; }
+    unsigned long long getFramesWritten() const { return framesWritten.load(); }
+    unsigned long long getFramesDropped() const { return framesDropped.load(); }
+
+private:
+    TrajectoryWriter(const TrajectoryWriter&);
+    TrajectoryWriter& operator=(const TrajectoryWriter&);
+
+    void writerLoop();
+
+    FILE* file;
+    TrajectoryHeader header;
+    unsigned tickInterval;
+    size_t peakCount; // most UAVs in a submitted frame
+
+    std::vector<std::vector<char> > buffers; // each holds one encoded frame
+    SpscIndexQueue freeBuffers;   // writer thread -> simulation thread
+    SpscIndexQueue filledBuffers; // simulation thread -> writer thread
+
+    std::thread writerThread;
+    std::atomic<bool> stopping;
+    std::atomic<bool> writeFailed;
+    std::atomic<unsigned long long> framesWritten;
+    std::atomic<unsigned long long> framesDropped;
+};
+
+class TrajectoryReader
+{
+public:
+    TrajectoryReader();
+
+    // map a recording, returns false if it is missing or not a trajectory file
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return file.isOpen(); }
+    size_t frameCount() const { return frames; }
+    size_t uavCount() const { return header.uavCount; }
+    const TrajectoryHeader& getHeader() const { return header; }
+
+    // simulation time between consecutive frames
+    double frameSeconds() const { return header.dt * header.tickInterval; }
+
+    // decode frame index into out (resized to the frame's UAV count)
+    bool readFrame(size_t index, SwarmFrame& out) const;
+
+private:
+    MappedFile file;
+    TrajectoryHeader header;
+    size_t frames;
+    std::vector<uint64_t> frameOffsets; // where each frame starts, variable count only
+};
+
+#endif
@@ -0,0 +1,350 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the Unix domain socket transport. Messages are
+framed with an 8-byte length; an exchange writes and reads all peers at once
+with poll() on non-blocking sockets, so two ranks sending each other more than
+a socket buffer never deadlock.
+*/
+
+#include "Transport.h"
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <cstring>
+#include <cstdint>
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+// bytes of the length prefix
+static const size_t HEADER_SIZE = sizeof(uint64_t);
+
+static bool makeAddress(const std::string& path, sockaddr_un& address)
+{
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path))
+    {
+        std::cerr << "Socket path too long: " << path << "\n";
+        return false;
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size());
+    return true;
+}
+
+// blocking read / write of exactly size bytes (handshake only)
+static bool readAll(int fd, void* data, size_t size)
+{
+    char* p = static_cast<char*>(data);
+    while (size > 0)
+    {
+        ssize_t n = ::read(fd, p, size);
+        if (n <= 0)
+        {
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        p += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+static bool writeAll(int fd, const void* data, size_t size)
+{
+    const char* p = static_cast<const char*>(data);
+    while (size > 0)
+    {
+        ssize_t n = ::send(fd, p, size, MSG_NOSIGNAL);
+        if (n <= 0)
+        {
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        p += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+// constructor
+UnixSocketTransport::UnixSocketTransport() : myRank(0), numRanks(0), listenFd(-1)
+{
+}
+
+UnixSocketTransport::~UnixSocketTransport()
+{
+    close();
+}
+
+bool UnixSocketTransport::open(const std::string& dir, int rank, int size, const std::vector<int>& peers,
+                               double timeoutSeconds)
+{
+    close();
+    myRank = rank;
+    numRanks = size;
+    peerFds.assign(size, -1);
+
+    // listen before connecting anywhere so no pair waits on the other
+    sockaddr_un address;
+    listenPath = dir + "/rank" + std::to_string(rank) + ".sock";
+    if (!makeAddress(listenPath, address))
+    {
+        return false;
+    }
+    ::unlink(listenPath.c_str());
+    listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0 || ::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+        || ::listen(listenFd, size) != 0)
+    {
+        std::cerr << "Could not listen on " << listenPath << ": " << std::strerror(errno) << "\n";
+        close();
+        return false;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(timeoutSeconds);
+    int toAccept = 0;
+    for (int peer : peers)
+    {
+        if (peer > rank)
+        {
+            ++toAccept;
+            continue;
+        }
+
+        // lower peer: connect, then say who we are
+        sockaddr_un peerAddress;
+        if (!makeAddress(dir + "/rank" + std::to_string(peer) + ".sock", peerAddress))
+        {
+            close();
+            return false;
+        }
+        int fd = -1;
+        while (true)
+        {
+            fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd >= 0 && ::connect(fd, reinterpret_cast<sockaddr*>(&peerAddress), sizeof(peerAddress)) == 0)
+            {
+                break;
+            }
+            if (fd >= 0)
+            {
+                ::close(fd);
+            }
+            fd = -1;
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        int32_t id = rank;
+        if (fd < 0 || !writeAll(fd, &id, sizeof(id)))
+        {
+            std::cerr << "Rank " << rank << " could not connect to rank " << peer << "\n";
+            if (fd >= 0)
+            {
+                ::close(fd);
+            }
+            close();
+            return false;
+        }
+        peerFds[peer] = fd;
+    }
+
+    // higher peers connect to us, in whatever order they start
+    while (toAccept > 0)
+    {
+        pollfd waiting = { listenFd, POLLIN, 0 };
+        int remainingMs = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count());
+        if (remainingMs <= 0 || ::poll(&waiting, 1, remainingMs) <= 0)
+        {
+            std::cerr << "Rank " << rank << " timed out waiting for peers\n";
+            close();
+            return false;
+        }
+
+        int fd = ::accept(listenFd, nullptr, nullptr);
+        int32_t id = -1;
+        if (fd < 0 || !readAll(fd, &id, sizeof(id)) || id <= rank || id >= size || peerFds[id] >= 0)
+        {
+            std::cerr << "Rank " << rank << " rejected a bad peer connection\n";
+            if (fd >= 0)
+            {
+                ::close(fd);
+            }
+            close();
+            return false;
+        }
+        peerFds[id] = fd;
+        --toAccept;
+    }
+
+    for (int fd : peerFds)
+    {
+        if (fd >= 0)
+        {
+            ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        }
+    }
+    return true;
+}
+
+void UnixSocketTransport::close()
+{
+    for (int& fd : peerFds)
+    {
+        if (fd >= 0)
+        {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+    if (listenFd >= 0)
+    {
+        ::close(listenFd);
+        ::unlink(listenPath.c_str());
+        listenFd = -1;
+    }
+}
+
+int UnixSocketTransport::rank() const
+{
+    return myRank;
+}
+
+int UnixSocketTransport::size() const
+{
+    return numRanks;
+}
+
+bool UnixSocketTransport::exchange(std::vector<PeerMessage>& messages)
+{
+    const size_t count = messages.size();
+    std::vector<uint64_t> sendHeader(count), receiveSize(count, 0);
+    std::vector<size_t> sent(count, 0), received(count, 0);
+    std::vector<pollfd> fds(count);
+
+    for (size_t m = 0; m < count; ++m)
+    {
+        int peer = messages[m].peer;
+        if (peer < 0 || peer >= numRanks || peerFds[peer] < 0)
+        {
+            std::cerr << "Rank " << myRank << " has no connection to rank " << peer << "\n";
+            return false;
+        }
+        sendHeader[m] = messages[m].outgoing.size();
+        messages[m].incoming.clear();
+    }
+
+    while (true)
+    {
+        // still to send: header + payload; still to receive: until the header
+        // is in, then its payload
+        size_t active = 0;
+        for (size_t m = 0; m < count; ++m)
+        {
+            bool sending = sent[m] < HEADER_SIZE + sendHeader[m];
+            bool receiving = received[m] < HEADER_SIZE || received[m] < HEADER_SIZE + receiveSize[m];
+            // a finished peer is left out: its hang-up after its last exchange is not an error here
+            fds[m].fd = (sending || receiving) ? peerFds[messages[m].peer] : -1;
+            fds[m].events = static_cast<short>((sending ? POLLOUT : 0) | (receiving ? POLLIN : 0));
+            fds[m].revents = 0;
+            active += (sending || receiving);
+        }
+        if (active == 0)
+        {
+            return true;
+        }
+
+        if (::poll(fds.data(), fds.size(), -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+
+        for (size_t m = 0; m < count; ++m)
+        {
+            const int fd = fds[m].fd;
+            if (fds[m].revents & (POLLERR | POLLNVAL))
+            {
+                std::cerr << "Rank " << myRank << " lost rank " << messages[m].peer << "\n";
+                return false;
+            }
+
+            if (fds[m].revents & POLLOUT)
+            {
+                const std::vector<char>& out = messages[m].outgoing;
+                const char* p;
+                size_t left;
+                if (sent[m] < HEADER_SIZE)
+                {
+                    p = reinterpret_cast<const char*>(&sendHeader[m]) + sent[m];
+                    left = HEADER_SIZE - sent[m];
+                }
+                else
+                {
+                    p = out.data() + (sent[m] - HEADER_SIZE);
+                    left = out.size() - (sent[m] - HEADER_SIZE);
+                }
+                ssize_t n = ::send(fd, p, left, MSG_NOSIGNAL);
+                if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                {
+                    std::cerr << "Rank " << myRank << " could not send to rank " << messages[m].peer << "\n";
+                    return false;
+                }
+                sent[m] += (n > 0) ? static_cast<size_t>(n) : 0;
+            }
+
+            if ((fds[m].revents & (POLLIN | POLLHUP)) && (fds[m].events & POLLIN))
+            {
+                std::vector<char>& in = messages[m].incoming;
+                char* p;
+                size_t left;
+                if (received[m] < HEADER_SIZE)
+                {
+                    p = reinterpret_cast<char*>(&receiveSize[m]) + received[m];
+                    left = HEADER_SIZE - received[m];
+                }
+                else
+                {
+                    p = in.data() + (received[m] - HEADER_SIZE);
+                    left = in.size() - (received[m] - HEADER_SIZE);
+                }
+                ssize_t n = ::read(fd, p, left);
+                if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+                {
+                    std::cerr << "Rank " << myRank << " lost rank " << messages[m].peer << "\n";
+                    return false;
+                }
+                if (n > 0)
+                {
+                    received[m] += static_cast<size_t>(n);
+                    if (received[m] == HEADER_SIZE)
+                    {
+                        in.resize(receiveSize[m]);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,68 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for the message transport between domain processes
+(see SwarmDomain.h). A transport connects numbered ranks; each tick every rank
+swaps one message with each neighbouring rank. UnixSocketTransport is the local
+implementation (Unix domain stream sockets, POSIX only); a TCP transport only
+needs another subclass.
+*/
+
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+
+#include <vector>
+#include <string>
+
+// one message sent to and one received from a peer rank in an exchange
+struct PeerMessage
+{
+    int peer;
+    std::vector<char> outgoing;
+    std::vector<char> incoming;
+};
+
+class Transport
+{
+public:
+    virtual ~Transport() {}
+
+    virtual int rank() const = 0;
+    virtual int size() const = 0;
+
+    // send every outgoing message and wait for the matching incoming ones; all
+    // peers must call exchange the same number of times. Returns false if a
+    // peer disconnected or an I/O error occurred
+    virtual bool exchange(std::vector<PeerMessage>& messages) = 0;
+};
+
+class UnixSocketTransport : public Transport
+{
+public:
+    UnixSocketTransport();
+    ~UnixSocketTransport();
+
+    // listen on dir/rank<rank>.sock, then connect to the given peers: the
+    // higher rank of each pair connects (retrying until timeoutSeconds, so the
+    // processes may start in any order) and the lower rank accepts
+    bool open(const std::string& dir, int rank, int size, const std::vector<int>& peers,
+              double timeoutSeconds = 10.0);
+    void close();
+
+    int rank() const override;
+    int size() const override;
+    bool exchange(std::vector<PeerMessage>& messages) override;
+
+private:
+    UnixSocketTransport(const UnixSocketTransport&);
+    UnixSocketTransport& operator=(const UnixSocketTransport&);
+
+    int myRank;
+    int numRanks;
+    int listenFd;
+    std::string listenPath;
+    std::vector<int> peerFds; // by rank, -1 = not connected
+};
+
+#endif
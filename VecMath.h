@@ -0,0 +1,88 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Small 3D vector type shared by ECE_UAV and PID_Sim. Stored as four
+lanes (x, y, z and a padding lane w kept at 0) so a Vec3T<float> is exactly one
+SSE register and the compiler can keep whole-vector operations in registers.
+In-place fused operations (addScaled) and squared lengths avoid temporaries and
+square roots on hot paths.
+*/
+
+#ifndef VEC_MATH_H
+#define VEC_MATH_H
+
+#include <cmath>
+#include <algorithm>
+
+// alignment of a 4-lane vector, capped at 16 bytes: C++11 operator new (and so
+// std::vector) only guarantees 16, a Vec3T<double> is then two SSE registers
+template <class T>
+struct VecAlign
+{
+    enum { value = (4 * sizeof(T) < 16) ? 4 * sizeof(T) : 16 };
+};
+
+template <class T>
+struct alignas(VecAlign<T>::value) Vec3T
+{
+    T x, y, z;
+    T w; // padding lane, always 0
+
+    Vec3T(T x = 0, T y = 0, T z = 0) : x(x), y(y), z(z), w(0) {}
+
+    // arithmetic
+    Vec3T operator+(const Vec3T& v) const { return Vec3T(x + v.x, y + v.y, z + v.z); }
+    Vec3T operator-(const Vec3T& v) const { return Vec3T(x - v.x, y - v.y, z - v.z); }
+    Vec3T operator*(T s) const { return Vec3T(x * s, y * s, z * s); }
+    Vec3T operator/(T s) const { return Vec3T(x / s, y / s, z / s); }
+
+    // in place, no temporaries
+    Vec3T& operator+=(const Vec3T& v) { x += v.x; y += v.y; z += v.z; return *this; }
+    Vec3T& operator-=(const Vec3T& v) { x -= v.x; y -= v.y; z -= v.z; return *this; }
+    Vec3T& operator*=(T s) { x *= s; y *= s; z *= s; return *this; }
+    Vec3T& operator/=(T s) { x /= s; y /= s; z /= s; return *this; }
+
+    // this += v * s (one fused multiply-add per lane where the target has FMA)
+    Vec3T& addScaled(const Vec3T& v, T s)
+    {
+        x += v.x * s;
+        y += v.y * s;
+        z += v.z * s;
+        return *this;
+    }
+
+    // clamp every component to [lo, hi] (branch-free min/max)
+    Vec3T& clamp(T lo, T hi)
+    {
+        x = std::max(lo, std::min(hi, x));
+        y = std::max(lo, std::min(hi, y));
+        z = std::max(lo, std::min(hi, z));
+        return *this;
+    }
+
+    T dot(const Vec3T& v) const { return x * v.x + y * v.y + z * v.z; }
+
+    // prefer the squared forms for comparisons, they need no sqrt
+    T magnitudeSquared() const { return dot(*this); }
+    T magnitude() const { return std::sqrt(magnitudeSquared()); }
+
+    T distanceSquared(const Vec3T& v) const
+    {
+        T dx = x - v.x, dy = y - v.y, dz = z - v.z;
+        return dx * dx + dy * dy + dz * dz;
+    }
+    T distance(const Vec3T& v) const { return std::sqrt(distanceSquared(v)); }
+
+    Vec3T normalized() const
+    {
+        T mag = magnitude();
+        if (mag > 0) return *this / mag;
+        return Vec3T(0, 0, 0);
+    }
+};
+
+typedef Vec3T<float> Vec3f;
+typedef Vec3T<double> Vec3d;
+
+#endif
@@ -0,0 +1,137 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Implementation of the fixed-size worker pool used to step the swarm
+*/
+
+#include "WorkerPool.h"
+
+// constructor: spawn numWorkers - 1 helpers (calling thread is worker 0)
+WorkerPool::WorkerPool(unsigned numWorkers)
+    : generation(0), pendingHelpers(0), shuttingDown(false),
+      job(nullptr), jobCount(0), jobGrain(1), nextChunk(0)
+{
+    if (numWorkers == 0)
+    {
+        numWorkers = std::thread::hardware_concurrency();
+    }
+    if (numWorkers == 0)
+    {
+        numWorkers = 1;
+    }
+
+    helpers.reserve(numWorkers - 1);
+    for (unsigned i = 1; i < numWorkers; ++i)
+    {
+        helpers.emplace_back(&WorkerPool::workerLoop, this, i);
+    }
+}
+
+// destructor: wake helpers and join them
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        shuttingDown = true;
+    }
+    workCv.notify_all();
+
+    for (auto& th : helpers)
+    {
+        th.join();
+    }
+}
+
+unsigned WorkerPool::size() const
+{
+    return static_cast<unsigned>(helpers.size()) + 1;
+}
+
+// run fn over [0, count) in grain sized chunks on every worker
+void WorkerPool::parallelFor(size_t count, size_t grain, const ChunkFunction& fn)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    if (grain == 0)
+    {
+        grain = 1;
+    }
+
+    // single chunk or no helpers: just run inline
+    if (helpers.empty() || count <= grain)
+    {
+        for (size_t begin = 0; begin < count; begin += grain)
+        {
+            size_t end = (begin + grain < count) ? begin + grain : count;
+            fn(begin, end, 0);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        job = &fn;
+        jobCount = count;
+        jobGrain = grain;
+        nextChunk.store(0, std::memory_order_relaxed);
+        pendingHelpers = static_cast<unsigned>(helpers.size());
+        ++generation;
+    }
+    workCv.notify_all();
+
+    runChunks(0);
+
+    // wait for helpers to drain their chunks
+    std::unique_lock<std::mutex> lock(poolMutex);
+    doneCv.wait(lock, [this] { return pendingHelpers == 0; });
+    job = nullptr;
+}
+
+// helper thread: wait for a new generation, run chunks, report done
+void WorkerPool::workerLoop(unsigned workerId)
+{
+    unsigned long long seen = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(poolMutex);
+            workCv.wait(lock, [this, seen] { return shuttingDown || generation != seen; });
+            if (shuttingDown)
+            {
+                return;
+            }
+            seen = generation;
+        }
+
+        runChunks(workerId);
+
+        std::lock_guard<std::mutex> lock(poolMutex);
+        if (--pendingHelpers == 0)
+        {
+            doneCv.notify_one();
+        }
+    }
+}
+
+// grab chunks until none are left
+void WorkerPool::runChunks(unsigned workerId)
+{
+    const size_t numChunks = (jobCount + jobGrain - 1) / jobGrain;
+
+    while (true)
+    {
+        size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= numChunks)
+        {
+            return;
+        }
+
+        size_t begin = chunk * jobGrain;
+        size_t end = (begin + jobGrain < jobCount) ? begin + jobGrain : jobCount;
+        (*job)(begin, end, workerId);
+    }
+}
@@ -0,0 +1,59 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Interface for a fixed-size worker pool that runs chunked parallel loops
+*/
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <vector>
+#include <cstddef>
+
+class WorkerPool
+{
+public:
+    // chunk callback: [begin, end) range and the id of the worker running it
+    typedef std::function<void(size_t begin, size_t end, unsigned worker)> ChunkFunction;
+
+    // numWorkers = 0 sizes the pool to the number of cores
+    explicit WorkerPool(unsigned numWorkers = 0);
+    ~WorkerPool();
+
+    // split [0, count) into chunks of grain items and run them on all workers,
+    // returns once every chunk has finished (calling thread acts as worker 0)
+    void parallelFor(size_t count, size_t grain, const ChunkFunction& fn);
+
+    // total workers including the calling thread
+    unsigned size() const;
+
+private:
+    WorkerPool(const WorkerPool&);
+    WorkerPool& operator=(const WorkerPool&);
+
+    void workerLoop(unsigned workerId);
+    void runChunks(unsigned workerId);
+
+    std::vector<std::thread> helpers;
+
+    std::mutex poolMutex;
+    std::condition_variable workCv;
+    std::condition_variable doneCv;
+    unsigned long long generation;
+    unsigned pendingHelpers;
+    bool shuttingDown;
+
+    // current job
+    const ChunkFunction* job;
+    size_t jobCount;
+    size_t jobGrain;
+    std::atomic<size_t> nextChunk;
+};
+
+#endif
@@ -0,0 +1,731 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: uav_bench microbenchmarks: single PID controller updates (ECE_UAV and
+PID_Sim), swarm kernels and full ticks at 15 to 100k UAVs, collision passes at
+several densities, flocking neighbour queries, UAV spawn/retire (checking
+afterwards that every handle, mission and formation slot and the published
+snapshot followed the swarm),
+frustum culling and OBJ parse throughput. Items are UAV steps, contacts checked or
+vertices parsed, so "ns/item" is e.g. ns per UAV step.
+
+Usage: uav_bench [--filter TEXT] [--min-time S] [--csv FILE] [--baseline FILE] [--tolerance PCT]
+*/
+
+#include "Benchmark.h"
+#include "ECE_UAV.h"
+#include "PID_Sim.h"
+#include "SwarmState.h"
+#include "SwarmKernels.h"
+#include "SwarmScheduler.h"
+#include "SwarmCollisions.h"
+#include "MissionEngine.h"
+#include "SwarmBehaviours.h"
+#include "SwarmPool.h"
+#include "SwarmSnapshot.h"
+#include "Frustum.h"
+#include "WorkerPool.h"
+#include "Mesh.h"
+#include "ObjLoader.h"
+#include <vector>
+#include <string>
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <cstdio>
+
+// ---- single controller updates ----
+
+static void BM_EcePidCalculate(BenchState& state)
+{
+    PIDController pid(4.0, 0.2, 2.0);
+    double error = 1.0;
+    while (state.keepRunning())
+    {
+        benchDoNotOptimize(pid.calculate(error, 0.01));
+        error = (error > 0.0) ? -0.5 : 1.0; // stays clear of denormals
+    }
+    state.setItemsProcessed(static_cast<double>(state.getIterations()));
+}
+BENCHMARK(BM_EcePidCalculate);
+
+static void BM_EceApplyPIDControl(BenchState& state)
+{
+    ECE_UAV uav(0.0f, 0.0f, 0.0f);
+    while (state.keepRunning())
+    {
+        uav.applyPIDControl();
+        benchDoNotOptimize(uav.acc.z);
+    }
+    state.setItemsProcessed(static_cast<double>(state.getIterations()));
+}
+BENCHMARK(BM_EceApplyPIDControl);
+
+static void BM_EceControlLoop(BenchState& state)
+{
+    ECE_UAV uav(0.0f, 0.0f, 0.0f);
+    while (state.keepRunning())
+    {
+        uav.controlLoop();
+        benchDoNotOptimize(uav.pos.z);
+    }
+    state.setItemsProcessed(static_cast<double>(state.getIterations()));
+}
+BENCHMARK(BM_EceControlLoop);
+
+static void BM_PidSimPidCalculate(BenchState& state)
+{
+    pidsim::PIDController pid(4.0, 0.2, 2.0);
+    double error = 1.0;
+    while (state.keepRunning())
+    {
+        benchDoNotOptimize(pid.calculate(error, 0.01));
+        error = (error > 0.0) ? -0.5 : 1.0; // stays clear of denormals
+    }
+    state.setItemsProcessed(static_cast<double>(state.getIterations()));
+}
+BENCHMARK(BM_PidSimPidCalculate);
+
+static void BM_PidSimCascadeForces(BenchState& state)
+{
+    pidsim::UAV uav;
+    pidsim::Vec3 target(10.0, 10.0, 5.0);
+    while (state.keepRunning())
+    {
+        benchDoNotOptimize(uav.calculateControlForces(target, 0.01));
+    }
+    state.setItemsProcessed(static_cast<double>(state.getIterations()));
+}
+BENCHMARK(BM_PidSimCascadeForces);
+
+static void BM_PidSimSimpleForces(BenchState& state)
+{
+    pidsim::UAV uav;
+    pidsim::Vec3 target(10.0, 10.0, 5.0);
+    while (state.keepRunning())
+    {
+        benchDoNotOptimize(uav.calculateSimpleControlForces(target, 0.01));
+    }
+    state.setItemsProcessed(static_cast<double>(state.getIterations()));
+}
+BENCHMARK(BM_PidSimSimpleForces);
+
+// control + physics, one full single-UAV step of the path simulation
+static void BM_PidSimStep(BenchState& state)
+{
+    pidsim::UAV uav;
+    pidsim::Vec3 target(10.0, 10.0, 5.0);
+    while (state.keepRunning())
+    {
+        uav.update(uav.calculateControlForces(target, 0.01), 0.01);
+    }
+    benchDoNotOptimize(uav.getPosition());
+    state.setItemsProcessed(static_cast<double>(state.getIterations()));
+}
+BENCHMARK(BM_PidSimStep);
+
+// the pre-policy loop: strategy flag and dt checked at runtime on every step.
+// Steps range() independent UAVs so the result shows throughput, not just the
+// latency of one UAV's dependency chain
+static void BM_PidSimStepDispatch(BenchState& state)
+{
+    std::vector<pidsim::UAV> uavs(static_cast<size_t>(state.range()));
+    pidsim::Vec3 target(10.0, 10.0, 5.0);
+    volatile bool cascadeFlag = true;
+    volatile double dtValue = 0.01;
+    const bool cascade = cascadeFlag;
+    const double dt = dtValue;
+    while (state.keepRunning())
+    {
+        for (auto& uav : uavs)
+        {
+            pidsim::Vec3 force = cascade ? uav.calculateControlForces(target, dt)
+                                         : uav.calculateSimpleControlForces(target, dt);
+            uav.update(force, dt);
+        }
+    }
+    benchDoNotOptimize(uavs[0].getPosition());
+    state.setItemsProcessed(static_cast<double>(state.getIterations()) * uavs.size());
+}
+BENCHMARK_ARGS(BM_PidSimStepDispatch, 1, 64);
+
+// same steps through the compile-time policies, fixed 100 Hz (constexpr 1/dt)
+static void BM_PidSimStepPolicy(BenchState& state)
+{
+    std::vector<pidsim::UAV> uavs(static_cast<size_t>(state.range()));
+    pidsim::Vec3 target(10.0, 10.0, 5.0);
+    const pidsim::FixedRate<100> step;
+    while (state.keepRunning())
+    {
+        for (auto& uav : uavs)
+        {
+            uav.update(pidsim::CascadePID::forces(uav, target, step), step);
+        }
+    }
+    benchDoNotOptimize(uavs[0].getPosition());
+    state.setItemsProcessed(static_cast<double>(state.getIterations()) * uavs.size());
+}
+BENCHMARK_ARGS(BM_PidSimStepPolicy, 1, 64);
+
+// ---- swarm ----
+
+static void makeSwarm(SwarmState& swarm, size_t count)
+{
+    std::vector<ECE_UAV> uavs;
+    initFieldFormation(uavs, count);
+    swarm = SwarmState(uavs);
+}
+
+// sphere targets + PID + integration kernels only, one thread
+static void BM_SwarmKernel(BenchState& state)
+{
+    SwarmState swarm;
+    makeSwarm(swarm, static_cast<size_t>(state.range()));
+    while (state.keepRunning())
+    {
+        sphereTargetsRange(swarm, 0, swarm.size());
+        stepSwarmRange(swarm, 0, swarm.size());
+    }
+    benchDoNotOptimize(swarm.posZ[0]);
+    state.setItemsProcessed(static_cast<double>(state.getIterations()) * swarm.size());
+    state.setLabel(swarmKernelName());
+}
+BENCHMARK_ARGS(BM_SwarmKernel, 15, 1000, 10000, 100000);
+
+// ---- integrators ----
+
+// 256 UAVs climb from 10 m to fixed random targets and are compared after 5 s
+// with the same closed-loop model flown in double precision RK4 at dt = 0.1 ms.
+// Items are simulated UAV-seconds, so the per-item time is CPU cost per
+// UAV-second at the label's accuracy
+static const size_t INTEGRATOR_UAVS = 256;
+static const double INTEGRATOR_SECONDS = 5.0;
+
+static void makeIntegratorSwarm(SwarmState& swarm, int integrator, float dt)
+{
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<float> coord(0.0f, 40.0f);
+
+    swarm = SwarmState();
+    swarm.params.integrator = integrator;
+    swarm.params.dt = dt;
+    for (size_t i = 0; i < INTEGRATOR_UAVS; ++i)
+    {
+        float x = coord(rng), y = coord(rng);
+        swarm.addUAV(x, y, 10.0f);
+        swarm.targetX.back() = coord(rng);
+        swarm.targetY.back() = coord(rng);
+        swarm.targetZ.back() = 20.0f + coord(rng);
+    }
+}
+
+static void flyIntegratorSwarm(SwarmState& swarm)
+{
+    long ticks = std::lround(INTEGRATOR_SECONDS / swarm.params.dt);
+    for (long t = 0; t < ticks; ++t)
+    {
+        stepSwarmRange(swarm, 0, swarm.size());
+    }
+}
+
+// one axis of the model in SwarmKernels.cpp: y = (p, v, integral)
+static void referenceRate(const SwarmParams& p, double kp, double ki, double kd, double gravity,
+                          double target, const double* y, double* k)
+{
+    double f = kp * (target - y[0]) + ki * y[2] - (kd + p.dragCoeff) * y[1];
+    f = std::max(-static_cast<double>(p.maxForcePerAxis), std::min(static_cast<double>(p.maxForcePerAxis), f));
+    k[0] = y[1];
+    k[1] = f / p.mass + gravity;
+    k[2] = target - y[0];
+}
+
+// final positions, x y z per UAV
+static const std::vector<double>& integratorReference()
+{
+    static std::vector<double> reference;
+    if (!reference.empty())
+    {
+        return reference;
+    }
+
+    SwarmState start;
+    makeIntegratorSwarm(start, INTEGRATOR_RK4, 0.01f);
+    const SwarmParams& p = start.params;
+    const double h = 1e-4;
+    const long steps = std::lround(INTEGRATOR_SECONDS / h);
+
+    for (size_t i = 0; i < start.size(); ++i)
+    {
+        const double pos[3] = { start.posX[i], start.posY[i], start.posZ[i] };
+        const double target[3] = { start.targetX[i], start.targetY[i], start.targetZ[i] };
+        const double gains[3][3] = { { p.kpX, p.kiX, p.kdX }, { p.kpY, p.kiY, p.kdY }, { p.kpZ, p.kiZ, p.kdZ } };
+
+        for (int a = 0; a < 3; ++a)
+        {
+            double gravity = (a == 2) ? p.gravity : 0.0;
+            double y[3] = { pos[a], 0.0, 0.0 };
+            double k1[3], k2[3], k3[3], k4[3], t[3];
+            for (long n = 0; n < steps; ++n)
+            {
+                referenceRate(p, gains[a][0], gains[a][1], gains[a][2], gravity, target[a], y, k1);
+                for (int j = 0; j < 3; ++j) t[j] = y[j] + 0.5 * h * k1[j];
+                referenceRate(p, gains[a][0], gains[a][1], gains[a][2], gravity, target[a], t, k2);
+                for (int j = 0; j < 3; ++j) t[j] = y[j] + 0.5 * h * k2[j];
+                referenceRate(p, gains[a][0], gains[a][1], gains[a][2], gravity, target[a], t, k3);
+                for (int j = 0; j < 3; ++j) t[j] = y[j] + h * k3[j];
+                referenceRate(p, gains[a][0], gains[a][1], gains[a][2], gravity, target[a], t, k4);
+                for (int j = 0; j < 3; ++j) y[j] += h / 6.0 * (k1[j] + 2.0 * k2[j] + 2.0 * k3[j] + k4[j]);
+            }
+            reference.push_back(y[0]);
+        }
+    }
+    return reference;
+}
+
+static void integratorBench(BenchState& state, int integrator)
+{
+    const std::vector<double>& reference = integratorReference();
+    SwarmState start;
+    makeIntegratorSwarm(start, integrator, static_cast<float>(state.range()) * 0.001f);
+
+    SwarmState swarm;
+    while (state.keepRunning())
+    {
+        swarm = start;
+        flyIntegratorSwarm(swarm);
+    }
+
+    double maxErr = 0.0;
+    for (size_t i = 0; i < swarm.size(); ++i)
+    {
+        double dx = swarm.posX[i] - reference[i * 3];
+        double dy = swarm.posY[i] - reference[i * 3 + 1];
+        double dz = swarm.posZ[i] - reference[i * 3 + 2];
+        maxErr = std::max(maxErr, std::sqrt(dx * dx + dy * dy + dz * dz));
+    }
+
+    char label[64];
+    std::snprintf(label, sizeof(label), "%s, max err %.2e m", integratorName(integrator), maxErr);
+    state.setItemsProcessed(static_cast<double>(state.getIterations()) * INTEGRATOR_UAVS * INTEGRATOR_SECONDS);
+    state.setLabel(label);
+}
+
+// range = dt in ms
+static void BM_IntegratorEuler(BenchState& state) { integratorBench(state, INTEGRATOR_EULER); }
+BENCHMARK_ARGS(BM_IntegratorEuler, 1, 10, 50, 100);
+
+static void BM_IntegratorVerlet(BenchState& state) { integratorBench(state, INTEGRATOR_VERLET); }
+BENCHMARK_ARGS(BM_IntegratorVerlet, 10, 50, 100);
+
+static void BM_IntegratorRK4(BenchState& state) { integratorBench(state, INTEGRATOR_RK4); }
+BENCHMARK_ARGS(BM_IntegratorRK4, 10, 50, 100, 200);
+
+static void BM_IntegratorAdaptive(BenchState& state) { integratorBench(state, INTEGRATOR_ADAPTIVE); }
+BENCHMARK_ARGS(BM_IntegratorAdaptive, 10, 100, 500);
+
+// mission target pass for 10k UAVs with 8 random waypoints each; the tolerance
+// (range, in cm) sets how often UAVs arrive and take the scalar advance path
+static void BM_MissionTargets(BenchState& state)
+{
+    const size_t count = 10000;
+    SwarmState swarm;
+    makeSwarm(swarm, count);
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(0.0f, 50.0f);
+    MissionEngine missions;
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (int w = 0; w < 8; ++w)
+        {
+            float x = coord(rng), y = coord(rng), z = coord(rng);
+            missions.addWaypoint(i, x, y, z, state.range() * 0.01f);
+        }
+    }
+    missions.reset(swarm);
+
+    // UAVs scattered over the same volume so some are always near their waypoint
+    for (size_t i = 0; i < count; ++i)
+    {
+        swarm.posX[i] = coord(rng);
+        swarm.posY[i] = coord(rng);
+        swarm.posZ[i] = coord(rng);
+    }
+
+    while (state.keepRunning())
+    {
+        missionTargetsRange(swarm, missions, 0, count);
+    }
+    benchDoNotOptimize(swarm.targetX[0]);
+    state.setItemsProcessed(static_cast<double>(state.getIterations()) * count);
+    state.setLabel(std::to_string(missions.countCompleted()) + " completed");
+}
+BENCHMARK_ARGS(BM_MissionTargets, 1, 1000, 5000);
+
+// full scheduler tick: parallel integration, collisions, no snapshot
+static void BM_SwarmTick(BenchState& state)
+{
+    SwarmState swarm;
+    makeSwarm(swarm, static_cast<size_t>(state.range()));
+    SwarmScheduler scheduler(swarm, swarm.params.dt);
+    while (state.keepRunning())
+    {
+        scheduler.stepOnce();
+    }
+    state.setItemsProcessed(static_cast<double>(state.getIterations()) * swarm.size());
+    state.setLabel(std::to_string(scheduler.getWorkerCount()) + " workers");
+}
+BENCHMARK_ARGS(BM_SwarmTick, 15, 1000, 10000, 100000);
+
+// live UAVs of a spawn/retire run: handle, the posY it was given (a unique
+// tag, UAVs never move) and whether it was launched or there from the start
+struct TrackedUav
+{
+    UavHandle handle;
+    float tag;
+    bool launched;
+};
+
+// count UAVs tagged 0, 1, 2, ...
+static void makeTrackedSwarm(SwarmState& swarm, size_t count)
+{
+    makeSwarm(swarm, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        swarm.posY[i] = static_cast<float>(i);
+    }
+}
+
+// the starting UAVs, once the pool has handed them handles
+static void trackAll(const SwarmPool& pool, std::vector<TrackedUav>& live)
+{
+    for (size_t i = 0; i < pool.size(); ++i)
+    {
+        TrackedUav uav = { pool.handleAt(i), static_cast<float>(i), false };
+        live.push_back(uav);
+    }
+}
+
+// one landing (random live UAV) and one launch with the next tag
+static void spawnRetireOnce(SwarmPool& pool, std::vector<TrackedUav>& live, std::mt19937& rng, float& nextTag)
+{
+    const size_t pick = rng() % live.size();
+    pool.retire(live[pick].handle);
+    TrackedUav uav = { pool.spawn(0.0f, nextTag, 0.0f), nextTag, true };
+    live[pick] = uav;
+    nextTag = (nextTag < 16777215.0f) ? nextTag + 1.0f : 0.0f; // floats stay exact below 2^24
+}
+
+// every live handle still finds its own UAV, and nothing else is alive
+static std::string checkPool(const SwarmPool& pool, const SwarmState& swarm, const std::vector<TrackedUav>& live)
+{
+    if (pool.size() != live.size() || swarm.size() != live.size())
+    {
+        return "pool holds " + std::to_string(pool.size()) + " UAVs, expected " + std::to_string(live.size());
+    }
+    for (const auto& uav : live)
+    {
+        const size_t index = pool.indexOf(uav.handle);
+        if (index == SwarmPool::NO_INDEX || pool.handleAt(index).slot != uav.handle.slot
+            || pool.handleAt(index).generation != uav.handle.generation || swarm.posY[index] != uav.tag)
+        {
+            return "handle of UAV " + std::to_string(static_cast<long long>(uav.tag)) + " lost its UAV";
+        }
+    }
+    return std::string();
+}
+
+// one landing (random live UAV, by handle) and one launch per item, the swarm
+// holding steady at range UAVs; afterwards every handle must still name its UAV
+static void BM_SpawnRetire(BenchState& state)
+{
+    SwarmState swarm;
+    std::vector<TrackedUav> live;
+    const size_t count = static_cast<size_t>(state.range());
+    makeTrackedSwarm(swarm, count);
+    SwarmPool pool(swarm, swarm.size());
+    trackAll(pool, live);
+
+    std::mt19937 rng(7);
+    float nextTag = static_cast<float>(count);
+    while (state.keepRunning())
+    {
+        spawnRetireOnce(pool, live, rng, nextTag);
+    }
+    state.setItemsProcessed(static_cast<double>(state.getIterations()));
+    state.setLabel(std::to_string(pool.capacity()) + " slots");
+    state.setError(checkPool(pool, swarm, live));
+}
+BENCHMARK_ARGS(BM_SpawnRetire, 1000, 100000, 1000000);
+
+// the same with missions (two waypoints per starting UAV) and formation groups
+// of four attached, which the pool keeps in step; afterwards every UAV must
+// still fly its own list and every group follow a leader that leads itself
+static void BM_SpawnRetireAttached(BenchState& state)
+{
+    SwarmState swarm;
+    std::vector<TrackedUav> live;
+    const size_t count = static_cast<size_t>(state.range());
+    makeTrackedSwarm(swarm, count);
+
+    MissionEngine missions;
+    for (size_t i = 0; i < count; ++i)
+    {
+        missions.addWaypoint(i, 0.0f, swarm.posY[i], 20.0f, 1.0f);
+        missions.addWaypoint(i, 10.0f, swarm.posY[i], 20.0f, 1.0f);
+    }
+    missions.launchBegin = missions.launchEnd = static_cast<uint32_t>(missions.waypointCount());
+    missions.reset(swarm);
+    SwarmBehaviours behaviours;
+    behaviours.captureFormation(swarm, 4);
+
+    SwarmPool pool(swarm, swarm.size());
+    pool.setMissions(&missions);
+    pool.setBehaviours(&behaviours);
+    trackAll(pool, live);
+
+    std::mt19937 rng(7);
+    float nextTag = static_cast<float>(count);
+    while (state.keepRunning())
+    {
+        spawnRetireOnce(pool, live, rng, nextTag);
+    }
+    state.setItemsProcessed(static_cast<double>(state.getIterations()));
+
+    std::string error = checkPool(pool, swarm, live);
+    if (error.empty() && (missions.size() != swarm.size() || behaviours.leader.size() != swarm.size()))
+    {
+        error = "mission or formation arrays out of step with the swarm";
+    }
+    for (size_t k = 0; k < live.size() && error.empty(); ++k)
+    {
+        const size_t i = pool.indexOf(live[k].handle);
+        const bool ownList = missions.waypointCount(i) == 2 && missions.wpY[missions.listBegin[i]] == live[k].tag;
+        if (live[k].launched ? missions.waypointCount(i) != 0 : !ownList)
+        {
+            error = "UAV " + std::to_string(static_cast<long long>(live[k].tag)) + " flies the wrong mission";
+        }
+        const uint32_t head = behaviours.leader[i];
+        if (head >= swarm.size() || behaviours.leader[head] != head
+            || swarm.posY[i] - swarm.posY[head] != behaviours.slotY[i])
+        {
+            error = "UAV " + std::to_string(static_cast<long long>(live[k].tag)) + " lost its formation slot";
+        }
+    }
+    state.setError(error);
+}
+BENCHMARK_ARGS(BM_SpawnRetireAttached, 1000, 100000);
+
+// a fleet growing from range to twice that and back, one launch or landing and
+// one scheduler tick per item, with snapshots published as for the renderer;
+// afterwards the newest frame must hold exactly the swarm as it is
+static void BM_PoolTick(BenchState& state)
+{
+    SwarmState swarm;
+    std::vector<TrackedUav> live;
+    const size_t count = static_cast<size_t>(state.range());
+    makeTrackedSwarm(swarm, count);
+    SwarmSnapshotBuffer snapshots(swarm.size());
+    SwarmScheduler scheduler(swarm, swarm.params.dt, 1, &snapshots);
+    SwarmPool pool(swarm, 2 * count);
+    trackAll(pool, live);
+
+    std::mt19937 rng(7);
+    unsigned long long changes = 0;
+    while (state.keepRunning())
+    {
+        if ((++changes / count) % 2 == 0)
+        {
+            const float spot = static_cast<float>(changes % 100);
+            TrackedUav uav = { pool.spawn(spot * 2.0f, -10.0f, 0.0f), 0.0f, true }; // a 100 UAV launch line
+            live.push_back(uav);
+        }
+        else
+        {
+            const size_t pick = rng() % live.size();
+            pool.retire(live[pick].handle);
+            live[pick] = live.back();
+            live.pop_back();
+        }
+        scheduler.stepOnce();
+    }
+    state.setItemsProcessed(static_cast<double>(state.getIterations()));
+    state.setLabel(std::to_string(swarm.size()) + " UAVs at the end");
+
+    const SwarmFrame& frame = snapshots.readFrame();
+    bool same = frame.size() == swarm.size() && frame.layout == swarm.layout;
+    for (size_t i = 0; i < swarm.size() && same; ++i)
+    {
+        same = frame.posX[i] == swarm.posX[i] && frame.posY[i] == swarm.posY[i] && frame.posZ[i] == swarm.posZ[i];
+    }
+    if (!same)
+    {
+        state.setError("snapshot of " + std::to_string(frame.size()) + " UAVs does not match the swarm of "
+                       + std::to_string(swarm.size()));
+    }
+}
+BENCHMARK_ARGS(BM_PoolTick, 1000, 10000);
+
+// collision phase for 10k UAVs at the given density (UAVs per cubic meter);
+// at 1e6 per m^3 each UAV has about four neighbours inside the 1 cm contact distance
+static void BM_Collisions(BenchState& state)
+{
+    const size_t count = 10000;
+    const double side = std::cbrt(count / static_cast<double>(state.range()));
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(0.0f, static_cast<float>(side));
+
+    SwarmState swarm;
+    swarm.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        float x = coord(rng), y = coord(rng), z = coord(rng);
+        swarm.addUAV(x, y, 50.0f + z);
+    }
+
+    WorkerPool pool;
+    CollisionWorkspace work;
+    size_t contacts = 0;
+    while (state.keepRunning())
+    {
+        contacts = handleCollisions(swarm, work, pool);
+    }
+    state.setItemsProcessed(static_cast<double>(state.getIterations()) * count);
+    state.setLabel(std::to_string(contacts) + " contacts");
+}
+BENCHMARK_ARGS(BM_Collisions, 1, 1000, 100000, 1000000);
+
+// neighbour index rebuild + 7-nearest query + flocking steer for a grid of UAVs
+// 2 m apart (about 65 within the 5 m radius whatever the swarm size), one
+// thread; ns/item should stay flat from 1k to 50k
+static void BM_FlockSteer(BenchState& state)
+{
+    const size_t count = static_cast<size_t>(state.range());
+    const size_t side = static_cast<size_t>(std::ceil(std::cbrt(static_cast<double>(count))));
+    SwarmState swarm;
+    swarm.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        swarm.addUAV((i % side) * 2.0f, (i / side % side) * 2.0f, 10.0f + (i / (side * side)) * 2.0f);
+    }
+
+    FlockParams params;
+    params.separation = 1.0f;
+    params.alignment = 0.5f;
+    params.cohesion = 0.2f;
+    SwarmBehaviours behaviours(params);
+    while (state.keepRunning())
+    {
+        behaviours.buildIndex(swarm);
+        behaviours.steerRange(swarm, 0, count);
+        behaviours.restoreRange(swarm, 0, count);
+    }
+    benchDoNotOptimize(swarm.targetX[0]);
+    state.setItemsProcessed(static_cast<double>(state.getIterations()) * count);
+}
+BENCHMARK_ARGS(BM_FlockSteer, 1000, 10000, 50000);
+
+// ---- rendering ----
+
+// frustum cull + LOD sort of a 100k grid (6 m apart, as in scenario.txt) seen
+// from the corner at 300 m altitude looking along the diagonal; the range is
+// the vertical field of view in degrees, wider sees more of the swarm
+static void BM_FrustumCull(BenchState& state)
+{
+    const size_t count = 100000;
+    const size_t side = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+    std::vector<float> x(count), y(count), z(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        x[i] = (i % side) * 6.0f - 300.0f;
+        y[i] = (i / side) * 6.0f - 300.0f;
+        z[i] = 50.0f;
+    }
+
+    // gluPerspective(fov, 1, 1, 3000) and gluLookAt((-400, -400, 300), origin, z up)
+    const float fov = static_cast<float>(state.range());
+    const float f = 1.0f / std::tan(fov * 0.5f * 3.14159265f / 180.0f), n = 1.0f, fa = 3000.0f;
+    const float projection[16] = { f, 0, 0, 0, 0, f, 0, 0, 0, 0, (fa + n) / (n - fa), -1, 0, 0, 2 * fa * n / (n - fa), 0 };
+    Vec3f eye(-400.0f, -400.0f, 300.0f);
+    Vec3f forward = Vec3f(0.0f, 0.0f, 0.0f) - eye;
+    forward /= std::sqrt(forward.x * forward.x + forward.y * forward.y + forward.z * forward.z);
+    Vec3f right(forward.y, -forward.x, 0.0f);
+    right /= std::sqrt(right.x * right.x + right.y * right.y);
+    Vec3f up(right.y * forward.z - right.z * forward.y, right.z * forward.x - right.x * forward.z,
+             right.x * forward.y - right.y * forward.x);
+    const float modelview[16] =
+    {
+        right.x, up.x, -forward.x, 0,
+        right.y, up.y, -forward.y, 0,
+        right.z, up.z, -forward.z, 0,
+        -(right.x * eye.x + right.y * eye.y + right.z * eye.z),
+        -(up.x * eye.x + up.y * eye.y + up.z * eye.z),
+        forward.x * eye.x + forward.y * eye.y + forward.z * eye.z, 1
+    };
+    Frustum frustum;
+    frustum.extract(projection, modelview);
+
+    std::vector<float> lodDistances;
+    for (float pixels : { 48.0f, 16.0f, 6.0f })
+    {
+        lodDistances.push_back(screenSizeDistance(2.0f, fov, 1080, pixels));
+    }
+    std::vector<LodBatch> levels;
+    size_t visible = 0;
+    while (state.keepRunning())
+    {
+        visible = cullSwarm(x.data(), y.data(), z.data(), count, frustum, 2.0f, eye, lodDistances, levels);
+    }
+    state.setItemsProcessed(static_cast<double>(state.getIterations()) * count);
+    std::string label = std::to_string(visible) + " visible, lod";
+    for (const auto& level : levels)
+    {
+        label += " " + std::to_string(level.size());
+    }
+    state.setLabel(label);
+}
+BENCHMARK_ARGS(BM_FrustumCull, 20, 60, 120);
+
+// ---- OBJ parsing ----
+
+// OBJ text for a sphere with the given tessellation (v, vn and v//vn faces)
+static std::string makeSphereObj(int slices)
+{
+    Mesh sphere = makeSphereMesh(1.0f, slices, slices);
+    std::string text;
+    char line[128];
+    for (size_t i = 0; i < sphere.vertexCount(); ++i)
+    {
+        const float* v = &sphere.vertices[i * Mesh::FLOATS_PER_VERTEX];
+        std::snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvn %.6f %.6f %.6f\n", v[0], v[1], v[2], v[3], v[4], v[5]);
+        text += line;
+    }
+    for (size_t t = 0; t + 2 < sphere.indices.size(); t += 3)
+    {
+        unsigned a = sphere.indices[t] + 1, b = sphere.indices[t + 1] + 1, c = sphere.indices[t + 2] + 1;
+        std::snprintf(line, sizeof(line), "f %u//%u %u//%u %u//%u\n", a, a, b, b, c, c);
+        text += line;
+    }
+    return text;
+}
+
+static void BM_ObjParse(BenchState& state)
+{
+    std::string text = makeSphereObj(static_cast<int>(state.range()));
+    Mesh mesh;
+    while (state.keepRunning())
+    {
+        parseObj(text.data(), text.size(), mesh);
+    }
+    benchDoNotOptimize(mesh.vertices.data());
+    state.setItemsProcessed(static_cast<double>(state.getIterations()) * mesh.vertexCount());
+    state.setBytesProcessed(static_cast<double>(state.getIterations()) * text.size());
+}
+BENCHMARK_ARGS(BM_ObjParse, 16, 64, 256);
+
+int main(int argc, char** argv)
+{
+    return runBenchmarks(argc, argv);
+}
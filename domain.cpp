@@ -0,0 +1,358 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Domain-decomposed headless simulation. The swarm is split into x
+slabs (SwarmDomain.h), one per process, and the processes swap migrating and
+ghost UAVs with their neighbours every tick over Unix domain sockets. Without
+--rank the program starts all ranks itself as local processes; with --rank it
+runs that one rank, so the ranks can be started by hand or by a job script
+(every rank needs the same --ranks, --socket-dir and scenario options). The
+slabs are rebalanced every --rebalance-every ticks (0 = never).
+
+Usage: uav_domain [--ranks N] [--rank R] [--socket-dir DIR] [--scenario FILE] [--uavs N]
+                  [--seconds S] [--threads T] [--ghost-width M] [--rebalance-every N]
+                  [--no-collisions]
+*/
+
+#include "SwarmState.h"
+#include "SwarmScheduler.h"
+#include "SwarmDomain.h"
+#include "SwarmBehaviours.h"
+#include "Transport.h"
+#include "Scenario.h"
+#include "Profiler.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// x coordinates sampled to place the initial slab faces
+static const size_t SLAB_SAMPLES = 65536;
+
+// command line options
+struct DomainOptions
+{
+    int ranks;
+    int rank;              // -1 = start every rank
+    std::string socketDir; // empty = a fresh temporary directory
+    std::string scenarioPath;
+    size_t numUAVs;        // 0 = as many as the scenario says
+    double seconds;
+    unsigned threads;      // 0 = the cores shared between the ranks
+    float ghostWidth;      // 0 = interaction range + 1 m
+    unsigned rebalanceEvery;
+    bool collisions;
+
+    DomainOptions()
+        : ranks(2), rank(-1), numUAVs(0), seconds(10.0), threads(0), ghostWidth(0.0f), rebalanceEvery(100),
+          collisions(true) {}
+};
+
+static void printUsage()
+{
+    std::cout << "Usage: uav_domain [--ranks N] [--rank R] [--socket-dir DIR] [--scenario FILE] [--uavs N]\n"
+                 "                  [--seconds S] [--threads T] [--ghost-width M] [--rebalance-every N]\n"
+                 "                  [--no-collisions]\n";
+}
+
+// parse argv, returns false on bad input
+static bool parseOptions(int argc, char** argv, DomainOptions& opts)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--ranks" && hasValue)
+        {
+            opts.ranks = std::atoi(argv[++i]);
+        }
+        else if (arg == "--rank" && hasValue)
+        {
+            opts.rank = std::atoi(argv[++i]);
+        }
+        else if (arg == "--socket-dir" && hasValue)
+        {
+            opts.socketDir = argv[++i];
+        }
+        else if (arg == "--scenario" && hasValue)
+        {
+            opts.scenarioPath = argv[++i];
+        }
+        else if (arg == "--uavs" && hasValue)
+        {
+            opts.numUAVs = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--seconds" && hasValue)
+        {
+            opts.seconds = std::strtod(argv[++i], nullptr);
+        }
+        else if (arg == "--threads" && hasValue)
+        {
+            opts.threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--ghost-width" && hasValue)
+        {
+            opts.ghostWidth = static_cast<float>(std::strtod(argv[++i], nullptr));
+        }
+        else if (arg == "--rebalance-every" && hasValue)
+        {
+            opts.rebalanceEvery = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--no-collisions")
+        {
+            opts.collisions = false;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return opts.ranks > 0 && opts.rank < opts.ranks && opts.seconds > 0.0;
+}
+
+// one rank from start to finish, returns the process exit code
+static int runRank(const DomainOptions& opts)
+{
+    const int rank = opts.rank;
+    Scenario scenario;
+    if (!opts.scenarioPath.empty() && !loadScenario(opts.scenarioPath, scenario))
+    {
+        return 1;
+    }
+    if (opts.numUAVs > 0)
+    {
+        scenario.uavCount = opts.numUAVs;
+    }
+    if (!scenario.missionPath.empty() || scenario.formationGroup > 1)
+    {
+        // both are indexed by UAV, which changes as UAVs migrate
+        std::cerr << "Missions and formation groups are not supported across domains\n";
+        return 1;
+    }
+
+    // every rank streams the same formation twice: a sample of it places the
+    // slab faces, then only the slab's UAVs are kept, so no rank ever holds the
+    // whole swarm (the first rebalance evens out the sampling error)
+    const size_t totalUAVs = scenario.uavCount;
+    const size_t sampleStride = std::max<size_t>(1, totalUAVs / SLAB_SAMPLES);
+    std::vector<float> sample;
+    FormationStream sampler(scenario);
+    for (size_t i = 0; i < totalUAVs; ++i)
+    {
+        float x, y, z;
+        sampler.next(x, y, z);
+        if (i % sampleStride == 0)
+        {
+            sample.push_back(x);
+        }
+    }
+    std::vector<float> faces;
+    SwarmDomain::splitSlabs(sample, opts.ranks, faces);
+    sample = std::vector<float>();
+
+    SwarmBehaviours behaviours(scenario.flock);
+    float ghostWidth = opts.ghostWidth;
+    if (ghostWidth <= 0.0f)
+    {
+        // UAVs move less than a metre per tick at any sane speed and dt
+        float range = behaviours.isFlocking() ? std::max(scenario.params.collisionDistance, scenario.flock.radius)
+                                              : scenario.params.collisionDistance;
+        ghostWidth = range + 1.0f;
+    }
+
+    UnixSocketTransport transport;
+    std::vector<int> peers;
+    if (rank > 0)
+    {
+        peers.push_back(rank - 1);
+    }
+    if (rank + 1 < opts.ranks)
+    {
+        peers.push_back(rank + 1);
+    }
+    if (!transport.open(opts.socketDir, rank, opts.ranks, peers))
+    {
+        return 1;
+    }
+
+    SwarmDomain domain(transport, faces[rank], faces[rank + 1], ghostWidth);
+    domain.state().params = scenario.params;
+    FormationStream formation(scenario);
+    for (size_t i = 0; i < totalUAVs; ++i)
+    {
+        float x, y, z;
+        formation.next(x, y, z);
+        if (x >= faces[rank] && x < faces[rank + 1])
+        {
+            domain.addUAV(static_cast<uint32_t>(i), x, y, z);
+        }
+    }
+
+    unsigned threads = opts.threads;
+    if (threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency() / opts.ranks);
+    }
+    SwarmScheduler scheduler(domain.state(), domain.state().params.dt, threads);
+    scheduler.setCollisionsEnabled(opts.collisions);
+    if (behaviours.isFlocking())
+    {
+        scheduler.setBehaviours(&behaviours);
+    }
+
+    // whole ticks covering the time, a thousandth of a tick of float dt error allowed
+    const unsigned long long ticks =
+        static_cast<unsigned long long>(std::ceil(opts.seconds / domain.state().params.dt - 1e-3));
+    if (rank == 0)
+    {
+        std::cout << "=== Domain-Decomposed UAV Swarm Simulation ===\n";
+        std::cout << "UAVs: " << totalUAVs << " (" << formationName(scenario.formation) << " formation) over "
+                  << opts.ranks << " ranks, " << threads << " workers each\n";
+        std::cout << "Simulated time: " << opts.seconds << " s (" << ticks << " ticks), ghost width "
+                  << ghostWidth << " m\n\n";
+    }
+
+    // exchange, then step
+    double exchangeSeconds = 0.0;
+    double ghostTotal = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long long t = 0; t < ticks; ++t)
+    {
+        uint64_t exchangeStart = Profiler::now();
+        {
+            PROFILE_SCOPE("exchange");
+            bool rebalance = opts.rebalanceEvery > 0 && t > 0 && t % opts.rebalanceEvery == 0;
+            if ((rebalance && !domain.rebalance()) || !domain.exchange())
+            {
+                std::cerr << "Rank " << rank << " lost its neighbours at tick " << t << "\n";
+                return 1;
+            }
+        }
+        exchangeSeconds += (Profiler::now() - exchangeStart) * 1e-9;
+        ghostTotal += domain.ghostCount();
+        scheduler.stepOnce();
+    }
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // collect per-rank results on every rank, rank 0 reports
+    std::vector<double> owned, migrated, ghosts, walls, exchanges, minX, maxX;
+    if (!domain.gather(static_cast<double>(domain.ownedCount()), owned)
+        || !domain.gather(static_cast<double>(domain.getMigratedOut()), migrated)
+        || !domain.gather(ghostTotal / ticks, ghosts)
+        || !domain.gather(wall, walls)
+        || !domain.gather(exchangeSeconds, exchanges)
+        || !domain.gather(domain.getMinX(), minX)
+        || !domain.gather(domain.getMaxX(), maxX))
+    {
+        return 1;
+    }
+    if (rank != 0)
+    {
+        return 0;
+    }
+
+    std::cout << "=== Per Rank ===\n";
+    std::cout << std::fixed << std::setprecision(3);
+    double ownedTotal = 0.0, migratedTotal = 0.0, slowest = 0.0;
+    for (int r = 0; r < opts.ranks; ++r)
+    {
+        std::cout << "rank " << r << ": x [" << std::setprecision(1) << minX[r] << ", " << maxX[r] << "), "
+                  << static_cast<size_t>(owned[r]) << " UAVs, "
+                  << static_cast<size_t>(migrated[r]) << " migrated out, "
+                  << std::setprecision(1) << ghosts[r] << " ghosts per tick, "
+                  << std::setprecision(3) << walls[r] << " s wall (" << exchanges[r] << " s exchanging)\n";
+        ownedTotal += owned[r];
+        migratedTotal += migrated[r];
+        slowest = std::max(slowest, walls[r]);
+    }
+
+    std::cout << "\n=== Simulation Statistics ===\n";
+    std::cout << "UAVs at the end: " << static_cast<size_t>(ownedTotal) << " of " << totalUAVs
+              << (static_cast<size_t>(ownedTotal) == totalUAVs ? "" : "  (MISMATCH)") << "\n";
+    std::cout << "Migrations: " << static_cast<size_t>(migratedTotal) << "\n";
+    std::cout << "Wall time (slowest rank): " << slowest << " s\n";
+    std::cout << "Faster than real time: " << (opts.seconds / slowest) << "x\n";
+    std::cout << "UAV steps per second: " << (static_cast<double>(ticks) * totalUAVs / slowest) << "\n";
+    return static_cast<size_t>(ownedTotal) == totalUAVs ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+    DomainOptions opts;
+    if (!parseOptions(argc, argv, opts))
+    {
+        printUsage();
+        return 1;
+    }
+
+    if (opts.rank >= 0)
+    {
+        if (opts.socketDir.empty())
+        {
+            std::cerr << "--rank needs the --socket-dir shared by every rank\n";
+            return 1;
+        }
+        return runRank(opts);
+    }
+
+    // start every rank as a child process on this machine
+    bool ownDir = opts.socketDir.empty();
+    if (ownDir)
+    {
+        char pattern[] = "/tmp/uav_domain.XXXXXX";
+        if (!mkdtemp(pattern))
+        {
+            std::cerr << "Could not create a socket directory\n";
+            return 1;
+        }
+        opts.socketDir = pattern;
+    }
+
+    std::cout.flush();
+    std::vector<pid_t> children;
+    for (int r = 0; r < opts.ranks; ++r)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            opts.rank = r;
+            std::exit(runRank(opts));
+        }
+        if (pid < 0)
+        {
+            std::cerr << "Could not start rank " << r << "\n";
+            break;
+        }
+        children.push_back(pid);
+    }
+
+    int failures = (static_cast<int>(children.size()) == opts.ranks) ? 0 : 1;
+    for (pid_t pid : children)
+    {
+        int status = 0;
+        if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        {
+            ++failures;
+        }
+    }
+    if (ownDir)
+    {
+        rmdir(opts.socketDir.c_str());
+    }
+    if (failures > 0)
+    {
+        std::cerr << failures << " rank(s) failed\n";
+        return 1;
+    }
+    return 0;
+}
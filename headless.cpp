@@ -0,0 +1,602 @@
+/*
+Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
+Class: ECE 4122
+Last Date Modified: 10/16/2026
+Description: Headless batch simulation. Steps the swarm as fast as the CPU allows
+for a given number of simulated seconds (no window, no OpenGL, no wall-clock
+pacing) and prints summary metrics for regression runs and capacity planning.
+
+Usage: uav_headless [--scenario FILE] [--uavs N] [--seconds S] [--dt S] [--integrator NAME]
+                    [--threads T] [--no-collisions] [--trace FILE]
+                    [--record FILE [--quantize] [--record-every N]] [--missions FILE [--no-loop]]
+                    [--checkpoint FILE [--checkpoint-every S]] [--restore FILE]
+                    [--launch-rate N] [--battery S]
+
+--checkpoint saves the whole run (swarm, controllers, mission progress) at the
+end, and every S simulated seconds with --checkpoint-every. --restore carries on
+from a checkpoint for another --seconds; the swarm, physics, missions, flocking,
+formation and collision setting then come from the checkpoint instead of the
+scenario (--no-collisions still turns collisions off).
+
+--launch-rate launches N UAVs per simulated second from a pad at the formation
+origin, --battery lands (retires) every UAV after S seconds of flight, the
+starting ones staggered over their first S seconds. The swarm then lives in a
+SwarmPool: launched UAVs fly the * waypoints of the missions (or orbit the
+sphere) outside any formation group, and --record writes frames of varying size.
+*/
+
+#include "ECE_UAV.h"
+#include "SwarmState.h"
+#include "SwarmScheduler.h"
+#include "SwarmKernels.h"
+#include "Profiler.h"
+#include "Trajectory.h"
+#include "MissionEngine.h"
+#include "Scenario.h"
+#include "SwarmBehaviours.h"
+#include "Checkpoint.h"
+#include "SwarmPool.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+
+// command line options
+struct HeadlessOptions
+{
+    std::string scenarioPath; // empty = default field formation
+    size_t numUAVs;           // 0 = as many as the scenario says
+    double seconds;
+    double dt;               // 0 = the scenario's physics.dt
+    int integrator;          // -1 = the scenario's physics.integrator
+    unsigned threads;
+    bool collisions;
+    std::string tracePath; // Chrome trace of the last ticks, empty = none
+    std::string recordPath; // trajectory recording, empty = none
+    TrajectoryOptions record;
+    std::string missionPath; // waypoint missions, empty = orbit the sphere
+    bool loopMissions;
+    std::string checkpointPath; // checkpoint written at the end, empty = none
+    double checkpointEvery;     // simulated seconds between checkpoints, 0 = end only
+    std::string restorePath;    // checkpoint to resume from, empty = start fresh
+    double launchRate;          // UAVs launched per simulated second, 0 = none
+    double battery;             // seconds each UAV flies before landing, 0 = forever
+
+    HeadlessOptions()
+        : numUAVs(0), seconds(60.0), dt(0.0), integrator(-1), threads(0), collisions(true), loopMissions(true),
+          checkpointEvery(0.0), launchRate(0.0), battery(0.0) {}
+};
+
+static void printUsage()
+{
+    std::cout << "Usage: uav_headless [--scenario FILE] [--uavs N] [--seconds S] [--dt S] [--integrator NAME]\n"
+                 "                    [--threads T] [--no-collisions] [--trace FILE]\n"
+                 "                    [--record FILE [--quantize] [--record-every N]] [--missions FILE [--no-loop]]\n"
+                 "                    [--checkpoint FILE [--checkpoint-every S]] [--restore FILE]\n"
+                 "                    [--launch-rate N] [--battery S]\n";
+}
+
+// parse argv, returns false on bad input
+static bool parseOptions(int argc, char** argv, HeadlessOptions& opts)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--scenario" && hasValue)
+        {
+            opts.scenarioPath = argv[++i];
+        }
+        else if (arg == "--uavs" && hasValue)
+        {
+            opts.numUAVs = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--seconds" && hasValue)
+        {
+            opts.seconds = std::strtod(argv[++i], nullptr);
+        }
+        else if (arg == "--dt" && hasValue)
+        {
+            opts.dt = std::strtod(argv[++i], nullptr);
+        }
+        else if (arg == "--integrator" && hasValue)
+        {
+            std::string name = argv[++i];
+            for (int m = 0; m < NUM_INTEGRATORS; ++m)
+            {
+                if (name == integratorName(m))
+                {
+                    opts.integrator = m;
+                }
+            }
+            if (opts.integrator < 0)
+            {
+                return false;
+            }
+        }
+        else if (arg == "--threads" && hasValue)
+        {
+            opts.threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--no-collisions")
+        {
+            opts.collisions = false;
+        }
+        else if (arg == "--trace" && hasValue)
+        {
+            opts.tracePath = argv[++i];
+        }
+        else if (arg == "--record" && hasValue)
+        {
+            opts.recordPath = argv[++i];
+        }
+        else if (arg == "--quantize")
+        {
+            opts.record.quantized = true;
+        }
+        else if (arg == "--record-every" && hasValue)
+        {
+            opts.record.tickInterval = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--missions" && hasValue)
+        {
+            opts.missionPath = argv[++i];
+        }
+        else if (arg == "--no-loop")
+        {
+            opts.loopMissions = false;
+        }
+        else if (arg == "--checkpoint" && hasValue)
+        {
+            opts.checkpointPath = argv[++i];
+        }
+        else if (arg == "--checkpoint-every" && hasValue)
+        {
+            opts.checkpointEvery = std::strtod(argv[++i], nullptr);
+        }
+        else if (arg == "--restore" && hasValue)
+        {
+            opts.restorePath = argv[++i];
+        }
+        else if (arg == "--launch-rate" && hasValue)
+        {
+            opts.launchRate = std::strtod(argv[++i], nullptr);
+        }
+        else if (arg == "--battery" && hasValue)
+        {
+            opts.battery = std::strtod(argv[++i], nullptr);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return opts.seconds > 0.0 && opts.dt >= 0.0 && opts.checkpointEvery >= 0.0 && opts.launchRate >= 0.0
+           && opts.battery >= 0.0;
+}
+
+// UAV landing when its battery runs out
+struct Landing
+{
+    UavHandle uav;
+    unsigned long long tick;
+};
+
+// launches and landings of --launch-rate / --battery. Every UAV flies the same
+// time, so landings come due in the order they were queued
+struct FleetSchedule
+{
+    std::vector<Landing> landings;
+    size_t nextLanding;
+    double launchCredit; // fractional launches carried to the next tick
+    unsigned long long batteryTicks;
+    size_t launched;
+    size_t landed;
+    size_t peak;
+
+    FleetSchedule() : nextLanding(0), launchCredit(0.0), batteryTicks(0), launched(0), landed(0), peak(0) {}
+};
+
+// queue the starting UAVs' landings, spread over the first battery so they do
+// not all come down on the same tick
+static void startFleet(FleetSchedule& fleet, const SwarmPool& pool, const HeadlessOptions& opts,
+                       unsigned long long tick, float dt)
+{
+    fleet.batteryTicks = static_cast<unsigned long long>(std::llround(opts.battery / dt));
+    fleet.peak = pool.size();
+    if (fleet.batteryTicks == 0)
+    {
+        return;
+    }
+    for (size_t i = 0; i < pool.size(); ++i)
+    {
+        Landing landing = { pool.handleAt(i), tick + 1 + fleet.batteryTicks * i / pool.size() };
+        fleet.landings.push_back(landing);
+    }
+}
+
+// launches and landings due before the next tick
+static void updateFleet(FleetSchedule& fleet, SwarmPool& pool, const HeadlessOptions& opts, const float pad[3],
+                        unsigned long long tick, float dt)
+{
+    PROFILE_SCOPE("fleet");
+    fleet.launchCredit += opts.launchRate * dt;
+    while (fleet.launchCredit >= 1.0)
+    {
+        // 10 x 10 launch pad, 2 m apart
+        const size_t spot = fleet.launched % 100;
+        UavHandle uav = pool.spawn(pad[0] + (spot % 10) * 2.0f, pad[1] + (spot / 10) * 2.0f, pad[2]);
+        if (fleet.batteryTicks > 0)
+        {
+            Landing landing = { uav, tick + fleet.batteryTicks };
+            fleet.landings.push_back(landing);
+        }
+        fleet.launchCredit -= 1.0;
+        ++fleet.launched;
+    }
+    fleet.peak = std::max(fleet.peak, pool.size());
+
+    while (fleet.nextLanding < fleet.landings.size() && fleet.landings[fleet.nextLanding].tick <= tick)
+    {
+        fleet.landed += pool.retire(fleet.landings[fleet.nextLanding++].uav);
+    }
+
+    // drop handled landings now and then, the storage is kept for reuse
+    if (fleet.nextLanding > 4096 && fleet.nextLanding * 2 > fleet.landings.size())
+    {
+        fleet.landings.erase(fleet.landings.begin(), fleet.landings.begin() + fleet.nextLanding);
+        fleet.nextLanding = 0;
+    }
+}
+
+// print end-of-run statistics about the swarm relative to its target sphere
+static void printSwarmStats(const SwarmState& swarm)
+{
+    const SwarmParams& p = swarm.params;
+
+    double totalErr = 0.0;
+    double maxErr = 0.0;
+    double totalSpeed = 0.0;
+    double minAlt = 1e30;
+
+    for (size_t i = 0; i < swarm.size(); ++i)
+    {
+        double dx = swarm.posX[i] - p.centerX;
+        double dy = swarm.posY[i] - p.centerY;
+        double dz = swarm.posZ[i] - p.centerZ;
+        double err = std::fabs(std::sqrt(dx * dx + dy * dy + dz * dz) - p.radius);
+
+        totalErr += err;
+        if (err > maxErr) maxErr = err;
+
+        totalSpeed += std::sqrt(swarm.velX[i] * swarm.velX[i] + swarm.velY[i] * swarm.velY[i]
+                                + swarm.velZ[i] * swarm.velZ[i]);
+        if (swarm.posZ[i] < minAlt) minAlt = swarm.posZ[i];
+    }
+
+    std::cout << "Average shell error: " << (totalErr / swarm.size()) << " m\n";
+    std::cout << "Maximum shell error: " << maxErr << " m\n";
+    std::cout << "Average speed: " << (totalSpeed / swarm.size()) << " m/s\n";
+    std::cout << "Minimum altitude: " << minAlt << " m\n";
+}
+
+// nearest neighbour distances as of the last steering pass
+static void printNeighbourStats(const SwarmState& swarm, const SwarmBehaviours& behaviours)
+{
+    double total = 0.0;
+    double closest = 1e30;
+    size_t withNeighbours = 0;
+    for (size_t i = 0; i < swarm.size(); ++i)
+    {
+        if (behaviours.neighbourCount(i) == 0)
+        {
+            continue;
+        }
+        uint32_t j = behaviours.neighboursOf(i)[0];
+        double dx = swarm.posX[i] - swarm.posX[j];
+        double dy = swarm.posY[i] - swarm.posY[j];
+        double dz = swarm.posZ[i] - swarm.posZ[j];
+        double dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+        total += dist;
+        closest = std::min(closest, dist);
+        ++withNeighbours;
+    }
+
+    std::cout << "UAVs with neighbours in range: " << withNeighbours << " of " << swarm.size() << "\n";
+    if (withNeighbours > 0)
+    {
+        std::cout << "Nearest neighbour: average " << (total / withNeighbours) << " m, closest " << closest << " m\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    HeadlessOptions opts;
+    if (!parseOptions(argc, argv, opts))
+    {
+        printUsage();
+        return 1;
+    }
+
+    auto loadStart = std::chrono::steady_clock::now();
+    Scenario scenario;
+    if (!opts.scenarioPath.empty() && !loadScenario(opts.scenarioPath, scenario))
+    {
+        return 1;
+    }
+    if (opts.numUAVs > 0)
+    {
+        scenario.uavCount = opts.numUAVs;
+    }
+    if (opts.missionPath.empty())
+    {
+        opts.missionPath = scenario.missionPath;
+    }
+
+    // a checkpoint replaces the scenario's swarm, physics, missions and formation
+    SwarmState swarm;
+    CheckpointReader checkpoint;
+    if (!opts.restorePath.empty())
+    {
+        if (!checkpoint.open(opts.restorePath))
+        {
+            std::cerr << "Could not restore " << opts.restorePath << " (missing, damaged or not a checkpoint)\n";
+            return 1;
+        }
+        checkpoint.restore(swarm);
+        opts.missionPath = checkpoint.hasMissions() ? opts.restorePath : std::string();
+        opts.collisions = opts.collisions && checkpoint.collisionsEnabled();
+    }
+    else
+    {
+        buildSwarm(scenario, swarm);
+    }
+    if (opts.dt > 0.0)
+    {
+        swarm.params.dt = static_cast<float>(opts.dt);
+    }
+    if (opts.integrator >= 0)
+    {
+        swarm.params.integrator = opts.integrator;
+    }
+    const bool changingFleet = opts.launchRate > 0.0 || opts.battery > 0.0;
+    if (swarm.size() == 0 && !changingFleet)
+    {
+        printUsage();
+        return 1;
+    }
+    double loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+
+    SwarmScheduler scheduler(swarm, swarm.params.dt, opts.threads);
+    scheduler.setCollisionsEnabled(opts.collisions);
+    scheduler.setTickCount(checkpoint.getTick());
+
+    MissionEngine missions;
+    if (checkpoint.hasMissions())
+    {
+        checkpoint.restore(missions);
+        scheduler.setMissions(&missions, false);
+    }
+    else if (!opts.missionPath.empty())
+    {
+        if (!missions.load(opts.missionPath, swarm.size()))
+        {
+            return 1;
+        }
+        missions.setLooping(opts.loopMissions);
+        scheduler.setMissions(&missions);
+    }
+
+    SwarmBehaviours behaviours(scenario.flock);
+    if (checkpoint.isOpen())
+    {
+        checkpoint.restore(behaviours);
+    }
+    else if (scenario.formationGroup > 1)
+    {
+        behaviours.captureFormation(swarm, scenario.formationGroup);
+    }
+    if (behaviours.isActive())
+    {
+        scheduler.setBehaviours(&behaviours);
+    }
+
+    // launches and landings go through a pool, with room for the largest the
+    // swarm can get so launches never allocate
+    std::unique_ptr<SwarmPool> uavPool;
+    if (changingFleet)
+    {
+        const double flightSeconds = (opts.battery > 0.0) ? std::min(opts.battery, opts.seconds) : opts.seconds;
+        const size_t launches = static_cast<size_t>(std::ceil(opts.launchRate * flightSeconds));
+        uavPool.reset(new SwarmPool(swarm, swarm.size() + launches + 1));
+        uavPool->setMissions(opts.missionPath.empty() ? nullptr : &missions);
+        uavPool->setBehaviours(behaviours.leader.empty() ? nullptr : &behaviours);
+    }
+
+    // headless runs outpace the disk easily, give the writer a deeper queue
+    TrajectoryWriter recorder;
+    if (!opts.recordPath.empty())
+    {
+        opts.record.bufferFrames = 256;
+        opts.record.variableCount = changingFleet;
+        if (!recorder.open(opts.recordPath, changingFleet ? uavPool->capacity() : swarm.size(), swarm.params.dt,
+                           opts.record))
+        {
+            std::cerr << "Could not create " << opts.recordPath << "\n";
+            return 1;
+        }
+        recorder.submit(swarm, scheduler.getTickCount());
+        scheduler.setRecorder(&recorder);
+    }
+
+    // whole ticks covering the time; dt is a float (0.01f is a hair under 0.01),
+    // so allow a thousandth of a tick before rounding up
+    const unsigned long long ticks =
+        static_cast<unsigned long long>(std::ceil(opts.seconds / swarm.params.dt - 1e-3));
+
+    std::cout << "=== Headless UAV Swarm Simulation ===\n";
+    if (checkpoint.isOpen())
+    {
+        std::cout << "UAVs: " << swarm.size() << " (restored from " << opts.restorePath << " at tick "
+                  << checkpoint.getTick() << " in " << loadMs << " ms)\n";
+    }
+    else
+    {
+        std::cout << "UAVs: " << swarm.size() << " (" << formationName(scenario.formation) << " formation, loaded in "
+                  << loadMs << " ms)\n";
+    }
+    std::cout << "Simulated time: " << opts.seconds << " s (" << ticks << " ticks of "
+              << swarm.params.dt << " s)\n";
+    std::cout << "Workers: " << scheduler.getWorkerCount() << ", kernel: " << swarmKernelName()
+              << ", integrator: " << integratorName(swarm.params.integrator)
+              << ", collisions: " << (opts.collisions ? "on" : "off") << "\n";
+    if (!opts.missionPath.empty())
+    {
+        std::cout << "Missions: " << missions.waypointCount() << " waypoints from " << opts.missionPath << "\n";
+    }
+    if (behaviours.isFlocking())
+    {
+        const FlockParams& f = behaviours.params;
+        std::cout << "Flocking: " << f.neighbours << " neighbours within " << f.radius << " m (separation "
+                  << f.separation << ", alignment " << f.alignment << ", cohesion " << f.cohesion << ")\n";
+    }
+    if (checkpoint.hasFormation())
+    {
+        std::cout << "Formation keeping: slots from the checkpoint\n";
+    }
+    else if (!behaviours.leader.empty())
+    {
+        std::cout << "Formation keeping: groups of " << scenario.formationGroup << " UAVs\n";
+    }
+    if (!opts.checkpointPath.empty())
+    {
+        std::cout << "Checkpoint: " << opts.checkpointPath;
+        if (opts.checkpointEvery > 0.0)
+        {
+            std::cout << " every " << opts.checkpointEvery << " s";
+        }
+        std::cout << "\n";
+    }
+    std::cout << "\n";
+
+    // ticks between periodic checkpoints, 0 = only at the end
+    const unsigned long long checkpointTicks = opts.checkpointPath.empty() ? 0
+        : static_cast<unsigned long long>(std::llround(opts.checkpointEvery / swarm.params.dt));
+    size_t checkpointsWritten = 0;
+    double checkpointMs = 0.0;
+    auto saveCheckpoint = [&]() -> bool
+    {
+        auto saveStart = std::chrono::steady_clock::now();
+        bool saved = writeCheckpoint(opts.checkpointPath, swarm, scheduler.getTickCount(), opts.collisions,
+                                     missions.size() > 0 ? &missions : nullptr, &behaviours);
+        checkpointMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - saveStart).count();
+        checkpointsWritten += saved;
+        return saved;
+    };
+
+    FleetSchedule fleet;
+    if (changingFleet)
+    {
+        startFleet(fleet, *uavPool, opts, scheduler.getTickCount(), swarm.params.dt);
+        std::cout << "Fleet: launching " << opts.launchRate << " UAVs/s";
+        if (opts.battery > 0.0)
+        {
+            std::cout << ", landing after " << opts.battery << " s";
+        }
+        std::cout << " (pool capacity " << uavPool->capacity() << ")\n\n";
+    }
+
+    // step flat out, no sleeping
+    size_t totalContacts = 0;
+    double uavSteps = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long long t = 0; t < ticks; ++t)
+    {
+        if (changingFleet)
+        {
+            updateFleet(fleet, *uavPool, opts, scenario.origin, scheduler.getTickCount(), swarm.params.dt);
+        }
+        uavSteps += swarm.size();
+        scheduler.stepOnce();
+        totalContacts += scheduler.getLastContactCount();
+        if (checkpointTicks > 0 && (t + 1) % checkpointTicks == 0 && t + 1 < ticks)
+        {
+            saveCheckpoint();
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double wall = std::chrono::duration<double>(end - start).count();
+
+    if (!opts.checkpointPath.empty() && !saveCheckpoint())
+    {
+        return 1;
+    }
+
+    if (recorder.isOpen() && !recorder.close())
+    {
+        std::cerr << "Error while writing " << opts.recordPath << "\n";
+    }
+
+    std::cout << "=== Simulation Statistics ===\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Wall time: " << wall << " s\n";
+    std::cout << "Ticks per second: " << (ticks / wall) << "\n";
+    std::cout << "Faster than real time: " << (opts.seconds / wall) << "x\n";
+    std::cout << "UAV steps per second: " << (uavSteps / wall) << "\n";
+    std::cout << "Nanoseconds per UAV step: " << (wall * 1e9 / uavSteps) << "\n";
+    std::cout << "Collisions resolved: " << totalContacts << "\n";
+    if (changingFleet)
+    {
+        std::cout << "Launched: " << fleet.launched << ", landed: " << fleet.landed << ", peak " << fleet.peak
+                  << " UAVs, " << swarm.size() << " flying at the end\n";
+    }
+    if (!opts.missionPath.empty())
+    {
+        std::cout << "Missions completed: " << missions.countCompleted() << " of " << swarm.size() << " UAVs\n";
+    }
+    else if (swarm.size() > 0)
+    {
+        printSwarmStats(swarm);
+    }
+    if (behaviours.isFlocking())
+    {
+        printNeighbourStats(swarm, behaviours);
+    }
+    if (checkpointsWritten > 0)
+    {
+        std::cout << "Checkpoints written: " << checkpointsWritten << " (average " << (checkpointMs / checkpointsWritten)
+                  << " ms) to " << opts.checkpointPath << ", tick " << scheduler.getTickCount() << "\n";
+    }
+    if (!opts.recordPath.empty())
+    {
+        std::cout << "Frames recorded: " << recorder.getFramesWritten() << " (dropped "
+                  << recorder.getFramesDropped() << ") to " << opts.recordPath << "\n";
+    }
+
+    std::cout << "\n=== Phase Timings (last " << Profiler::RING_SIZE << " events per thread) ===\n";
+    std::vector<PhaseStats> phases;
+    Profiler::summarize(phases);
+    for (const auto& s : phases)
+    {
+        std::cout << std::left << std::setw(20) << s.name << std::right
+                  << " min " << s.minMs << " ms, avg " << s.avgMs << " ms, p99 " << s.p99Ms << " ms\n";
+    }
+
+    if (!opts.tracePath.empty())
+    {
+        if (!Profiler::writeChromeTrace(opts.tracePath))
+        {
+            std::cerr << "Could not write trace to " << opts.tracePath << "\n";
+            return 1;
+        }
+        std::cout << "Wrote trace to " << opts.tracePath << "\n";
+    }
+
+    return 0;
+}
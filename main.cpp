@@ -1,40 +1,111 @@
 /*
 Author: Manish Rangan, Kevin Ghobrial, Peter Samaan
 Class: ECE 4122
-Last Date Modified: 11/28/2025
-Description: Simulates 15 UAVs on a virtual football field using OpenGL. 
-Each UAV is represented by an instance of the ECE_UAV class and is managed
-in its own thread, allowing concurrent updates to position and behavior.
+Last Date Modified: 10/16/2026
+Description: Simulates 15 UAVs (or the swarm of a --scenario file) on a virtual
+football field using OpenGL. The swarm is advanced in lockstep fixed-step ticks
+by a SwarmScheduler on a worker pool; the renderer runs at its own rate (display
+refresh, or --fps N) and interpolates between the last two published ticks, so
+physics can tick at 1 kHz (--dt 0.001) or well below the frame rate. The camera
+flies freely (w/a/s/d, q/e, drag to look, c to reset); only UAVs inside the view
+frustum are drawn, each at a mesh level of detail chosen by its size on screen.
 */
 
 #include "ECE_UAV.h"
+#include "SwarmState.h"
+#include "SwarmScheduler.h"
+#include "SwarmRenderer.h"
+#include "ObjLoader.h"
+#include "Field.h"
+#include "Profiler.h"
+#include "ProfilerOverlay.h"
+#include "Trajectory.h"
+#include "MissionEngine.h"
+#include "Scenario.h"
+#include "SwarmBehaviours.h"
+#include "Camera.h"
+#include "Frustum.h"
 #include <iostream>
 #include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+#include <cctype>
 #include <GL/glut.h>
-#include <thread>
-#include <mutex>
+#ifdef FREEGLUT
+#include <GL/freeglut_ext.h>
+#endif
 
 
-// global UAVs vector
-std::vector<ECE_UAV> uavs;
-std::mutex uavMutex;
+// latest swarm state published by physics, read by display()
+SwarmSnapshotBuffer* snapshots = nullptr;
 
-// init UAVs onto football field
-void initUAVs()
-{
-    float uavPositions[15][2] = 
-    {
-        {0, 0}, {0, 25}, {0, 50}, {0, 75}, {0, 100},
-        {25, 0}, {25, 25}, {25, 50}, {25, 75}, {25, 100},
-        {50, 0}, {50, 25}, {50, 50}, {50, 75}, {50, 100}
-    };
+// blends the last two published ticks at the render time
+SwarmInterpolator interpolator;
 
-    for (int i = 0; i < 15; ++i)
-    {
-        uavs.emplace_back(uavPositions[i][0], uavPositions[i][1], 0.0f);
-    }
-}
+// --fps N: render cap, 0 = as fast as the display refreshes
+double renderFps = 0.0;
+uint64_t nextFrameTime = 0;
+
+// draws the visible swarm with one instanced call per level of detail
+SwarmRenderer renderer;
+
+// free camera; keys held down move it every frame, dragging turns it
+Camera camera;
+bool keysHeld[256] = {};
+uint64_t lastCameraUpdate = 0;
+int dragX = 0, dragY = 0;
+bool dragging = false;
+
+// perspective, also used for level-of-detail distances
+const float FOV_Y = 60.0f;
+const float NEAR_PLANE = 1.0f;
+const float FAR_PLANE = 3000.0f;
+
+// UAV bounding radius, and the on-screen diameters (pixels) below which the
+// next coarser mesh is used
+const float UAV_RADIUS = 2.0f;
+const float LOD_PIXELS[] = { 48.0f, 16.0f, 6.0f };
+const size_t NUM_LOD_SWITCHES = sizeof(LOD_PIXELS) / sizeof(LOD_PIXELS[0]);
+
+// visible UAVs per level, and the level distances for the current window;
+// lodScale pulls the distances in while the frame is over the triangle budget
+std::vector<LodBatch> lodBatches;
+std::vector<float> lodDistances(NUM_LOD_SWITCHES, 0.0f);
+float lodScale = 1.0f;
+size_t triangleBudget = 2000000;
 
+// fixed-step physics, read by the profiler overlay for ticks per second
+SwarmScheduler* physics = nullptr;
+
+// profiler overlay toggled with 'p'; Chrome trace written with 't', and on exit
+// when --trace <file> is given
+bool showProfiler = true;
+bool traceOnExit = false;
+std::string tracePath = "uav_trace.json";
+
+// --record <file>: trajectory of the live run
+TrajectoryWriter recorder;
+
+// --missions <file>: per-UAV waypoint lists instead of the sphere
+MissionEngine missions;
+
+// --replay <file>: play a recording back instead of simulating
+TrajectoryReader replay;
+SwarmFrame replayFrame;
+double replayPosition = 0.0; // fractional frame index
+double replaySpeed = 1.0;    // recorded seconds per wall second, negative = backwards
+bool replayPaused = false;
+uint64_t lastReplayUpdate = 0;
+uint64_t lastTitleUpdate = 0;
+
+// optional OBJ model drawn for each UAV instead of a sphere (--mesh <file>)
+std::string uavMeshPath;
+
+// field texture, looked up in the working directory then the source tree
+std::string fieldPath = "ff.bmp";
 
 // OpenGL initialization
 void initOpenGL()
@@ -44,84 +115,516 @@ void initOpenGL()
 
     glEnable(GL_DEPTH_TEST);
 
+    // textured field on top of the green background
+    bool fieldLoaded = initField(fieldPath);
+#ifdef UAV_ASSET_DIR
+    if (!fieldLoaded)
+    {
+        fieldLoaded = initField(std::string(UAV_ASSET_DIR) + "/" + fieldPath);
+    }
+#endif
+    if (!fieldLoaded)
+    {
+        std::cerr << "Could not load " << fieldPath << ", drawing plain background\n";
+    }
+
+    glMatrixMode(GL_MODELVIEW);
+
+    // UAV = sphere uploaded once (full detail is the tessellation of
+    // glutSolidSphere(2.0, 20, 20)) unless a model was given on the command
+    // line; a model's coarser levels are decimated from it
+    std::vector<Mesh> levels(1);
+    if (!uavMeshPath.empty())
+    {
+        if (loadObj(uavMeshPath, levels[0]))
+        {
+            fitMesh(levels[0], UAV_RADIUS);
+            const int resolutions[] = { 24, 10, 4 };
+            for (int resolution : resolutions)
+            {
+                levels.push_back(simplifyMesh(levels[0], resolution));
+            }
+        }
+        else
+        {
+            std::cerr << "Could not load " << uavMeshPath << ", drawing spheres\n";
+            levels[0] = Mesh();
+        }
+    }
+    if (levels[0].empty())
+    {
+        levels[0] = makeSphereMesh(UAV_RADIUS, 20, 20);
+        levels.push_back(makeSphereMesh(UAV_RADIUS, 10, 8));
+        levels.push_back(makeSphereMesh(UAV_RADIUS, 6, 4));
+        levels.push_back(makeSphereMesh(UAV_RADIUS, 4, 2));
+    }
+    renderer.init(levels);
+}
+
+// viewport, projection and level-of-detail distances follow the window size
+void reshape(int width, int height)
+{
+    height = std::max(height, 1);
+    glViewport(0, 0, width, height);
     glMatrixMode(GL_PROJECTION);
     glLoadIdentity();
-    gluPerspective(60.0, 1.0, 1.0, 500.00);
-
+    gluPerspective(FOV_Y, static_cast<double>(width) / height, NEAR_PLANE, FAR_PLANE);
     glMatrixMode(GL_MODELVIEW);
+
+    for (size_t l = 0; l < NUM_LOD_SWITCHES; ++l)
+    {
+        lodDistances[l] = screenSizeDistance(UAV_RADIUS, FOV_Y, height, LOD_PIXELS[l]);
+    }
+}
+
+// move the camera by the keys held since the last frame; capitals are 4x faster
+void updateCamera()
+{
+    uint64_t now = Profiler::now();
+    float seconds = (lastCameraUpdate > 0) ? std::min((now - lastCameraUpdate) * 1e-9f, 0.1f) : 0.0f;
+    lastCameraUpdate = now;
+
+    const float speed = 40.0f * seconds;
+    float forward = 0.0f, right = 0.0f, up = 0.0f;
+    const char keys[6] = { 'w', 's', 'd', 'a', 'e', 'q' };
+    float* axes[6] = { &forward, &forward, &right, &right, &up, &up };
+    for (int k = 0; k < 6; ++k)
+    {
+        float sign = (k % 2) ? -1.0f : 1.0f;
+        unsigned char lower = static_cast<unsigned char>(keys[k]);
+        unsigned char upper = static_cast<unsigned char>(keys[k] - 'a' + 'A');
+        if (keysHeld[lower])
+        {
+            *axes[k] += sign * speed;
+        }
+        if (keysHeld[upper])
+        {
+            *axes[k] += sign * speed * 4.0f;
+        }
+    }
+    camera.move(forward, right, up);
+}
+
+// frustum cull and sort into levels, then draw; the LOD distances shrink while
+// the visible triangles are over budget and grow back when well under it
+void drawSwarm(const SwarmFrame& frame, std::string& status)
+{
+    float projection[16], modelview[16];
+    glGetFloatv(GL_PROJECTION_MATRIX, projection);
+    glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+    Frustum frustum;
+    frustum.extract(projection, modelview);
+
+    std::vector<float> distances(lodDistances);
+    for (float& d : distances)
+    {
+        d *= lodScale;
+    }
+
+    size_t visible;
+    {
+        PROFILE_SCOPE("draw.cull");
+        visible = cullSwarm(frame.posX.data(), frame.posY.data(), frame.posZ.data(), frame.size(),
+                            frustum, UAV_RADIUS, camera.position, distances, lodBatches);
+    }
+    renderer.draw(lodBatches);
+
+    size_t triangles = 0;
+    std::string perLevel;
+    for (size_t l = 0; l < lodBatches.size() && renderer.levelCount() > 0; ++l)
+    {
+        triangles += lodBatches[l].size() * renderer.triangleCount(std::min(l, renderer.levelCount() - 1));
+        perLevel += (l ? "/" : "") + std::to_string(lodBatches[l].size());
+    }
+    if (triangles > triangleBudget)
+    {
+        lodScale = std::max(lodScale * 0.9f, 0.01f);
+    }
+    else if (triangles < triangleBudget / 2 && lodScale < 1.0f)
+    {
+        lodScale = std::min(lodScale * 1.05f, 1.0f);
+    }
+
+    char line[128];
+    std::snprintf(line, sizeof(line), "drawn %zu/%zu (lod %s) %.2fM tris", visible, frame.size(),
+                  perLevel.c_str(), triangles * 1e-6);
+    status = line;
+}
+
+// move the replay position by the wall time since the last frame
+void advanceReplay()
+{
+    uint64_t now = Profiler::now();
+    double elapsed = (lastReplayUpdate > 0) ? (now - lastReplayUpdate) * 1e-9 : 0.0;
+    lastReplayUpdate = now;
+
+    double lastFrame = static_cast<double>(replay.frameCount() - 1);
+    if (!replayPaused)
+    {
+        replayPosition += elapsed * replaySpeed / replay.frameSeconds();
+    }
+    if (replayPosition < 0.0 || replayPosition > lastFrame)
+    {
+        replayPosition = (replayPosition < 0.0) ? 0.0 : lastFrame;
+        replayPaused = true; // stop at either end
+    }
+
+    replay.readFrame(static_cast<size_t>(replayPosition), replayFrame);
+
+    // a few title updates a second are enough
+    if (now - lastTitleUpdate > 250000000ULL)
+    {
+        lastTitleUpdate = now;
+        char title[128];
+        std::snprintf(title, sizeof(title), "Replay frame %zu/%zu  tick %llu  %.2gx%s",
+                      static_cast<size_t>(replayPosition) + 1, replay.frameCount(), replayFrame.tick,
+                      replaySpeed, replayPaused ? "  (paused)" : "");
+        glutSetWindowTitle(title);
+    }
 }
 
 // display OpenGL
 void display() 
 {
+    // ends after the swap so the frame time includes the driver's share
+    PROFILE_SCOPE("frame");
+
+    std::string status;
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
 
     // set camera
-    gluLookAt(50.0, 50.0, 200.0, 
-        50.0, 50.0, 0.0, 
-        0.0, 1.0, 0.0);
+    updateCamera();
+    Vec3f eye = camera.position;
+    Vec3f center = eye + camera.forward();
+    Vec3f up = camera.up();
+    gluLookAt(eye.x, eye.y, eye.z, center.x, center.y, center.z, up.x, up.y, up.z);
 
-    // UAVs = red spheres for now
-    glColor3f(1.0, 0.0, 0.0);
+    {
+        PROFILE_SCOPE("draw.field");
+        drawField();
+    }
 
-    // lock mutex for thread safety
-    uavMutex.lock();
-    for (const auto& uav : uavs)
     {
-        glPushMatrix();
-        glTranslatef(uav.posX, uav.posY, uav.posZ);
-        glutSolidSphere(2.0, 20, 20); // UAV represented as sphere
-        glPopMatrix();
+        PROFILE_SCOPE("draw.swarm");
+
+        // UAVs = red spheres for now
+        glColor3f(1.0, 0.0, 0.0);
+
+        if (replay.isOpen())
+        {
+            advanceReplay();
+            drawSwarm(replayFrame, status);
+        }
+        else
+        {
+            // newest published snapshots, never blocks the physics thread
+            interpolator.update(*snapshots);
+            drawSwarm(interpolator.sample(Profiler::now()), status);
+        }
+    }
+
+    if (showProfiler)
+    {
+        drawProfilerOverlay(physics->getTickCount(), status);
     }
-    uavMutex.unlock();
 
     glutSwapBuffers();
 }
 
-// refresh display every 10 ms
-void updateScene(int value)
-{   
-    glutPostRedisplay(); 
-    glutTimerFunc(10, updateScene, 0); 
+// dump the profiler's buffered events for chrome://tracing
+void writeTrace()
+{
+    if (Profiler::writeChromeTrace(tracePath))
+    {
+        std::cout << "Wrote profiler trace to " << tracePath << "\n";
+    }
+    else
+    {
+        std::cerr << "Could not write profiler trace to " << tracePath << "\n";
+    }
+}
+
+// keyboard: p = toggle profiler overlay, t = write trace, c = reset camera,
+// w/a/s/d/q/e (held) = fly, capitals fly faster
+// replay: space = pause, + / - = speed x2 / half, r = reverse
+void keyboard(unsigned char key, int /*x*/, int /*y*/)
+{
+    keysHeld[key] = true;
+    if (key == 'c')
+    {
+        camera.reset();
+    }
+    else if (key == 'p')
+    {
+        showProfiler = !showProfiler;
+    }
+    else if (key == 't')
+    {
+        writeTrace();
+    }
+    else if (replay.isOpen())
+    {
+        if (key == ' ')
+        {
+            replayPaused = !replayPaused;
+        }
+        else if ((key == '+' || key == '=') && std::fabs(replaySpeed) < 1024.0)
+        {
+            replaySpeed *= 2.0;
+        }
+        else if (key == '-' && std::fabs(replaySpeed) > 1.0 / 64.0)
+        {
+            replaySpeed *= 0.5;
+        }
+        else if (key == 'r')
+        {
+            replaySpeed = -replaySpeed;
+        }
+    }
 }
 
+void keyboardUp(unsigned char key, int /*x*/, int /*y*/)
+{
+    // shift may be released before the letter, forget both cases
+    keysHeld[key] = false;
+    keysHeld[static_cast<unsigned char>(std::tolower(key))] = false;
+    keysHeld[static_cast<unsigned char>(std::toupper(key))] = false;
+}
 
-// main function
-int main(int argc, char** argv)
+// left drag turns the camera
+void mouse(int button, int state, int x, int y)
+{
+    if (button == GLUT_LEFT_BUTTON)
+    {
+        dragging = (state == GLUT_DOWN);
+        dragX = x;
+        dragY = y;
+    }
+}
+
+void motion(int x, int y)
 {
-    // initialize UAVs
-    initUAVs();
+    if (dragging)
+    {
+        camera.turn(-0.25f * (x - dragX), -0.25f * (y - dragY));
+        dragX = x;
+        dragY = y;
+    }
+}
 
-    std::vector<std::thread> threads;
-    threads.reserve(15);
+// replay scrubbing: left / right = one frame (pauses), page up / down = 10%,
+// home / end = first / last frame
+void specialKeys(int key, int /*x*/, int /*y*/)
+{
+    if (!replay.isOpen())
+    {
+        return;
+    }
 
-    for (int i = 0; i < 15; ++i)
+    double tenth = replay.frameCount() / 10.0;
+    switch (key)
     {
-        threads.emplace_back(threadFunction, &uavs[i]);
+    case GLUT_KEY_LEFT:      replayPaused = true; replayPosition = std::floor(replayPosition) - 1.0; break;
+    case GLUT_KEY_RIGHT:     replayPaused = true; replayPosition = std::floor(replayPosition) + 1.0; break;
+    case GLUT_KEY_PAGE_DOWN: replayPosition -= tenth; break;
+    case GLUT_KEY_PAGE_UP:   replayPosition += tenth; break;
+    case GLUT_KEY_HOME:      replayPosition = 0.0; break;
+    case GLUT_KEY_END:       replayPosition = replay.frameCount() - 1.0; break;
+    default: break;
     }
 
-    for (auto& th : threads)
+    // clamp here so a step at either end does not leave playback paused past it
+    double lastFrame = replay.frameCount() - 1.0;
+    replayPosition = std::max(0.0, std::min(lastFrame, replayPosition));
+}
+
+// uncapped: redraw whenever idle, the buffer swap waits for vsync
+void redrawWhenIdle()
+{
+    glutPostRedisplay();
+}
+
+// capped: redraw on absolute deadlines so timer slop does not add up
+void updateScene(int value)
+{
+    glutPostRedisplay();
+
+    const uint64_t period = static_cast<uint64_t>(1e9 / renderFps);
+    uint64_t now = Profiler::now();
+    nextFrameTime += period;
+    if (nextFrameTime + period < now)
     {
-        th.detach(); // detach threads to run independently
+        nextFrameTime = now; // fell a whole frame behind, do not try to catch up
     }
+    unsigned delayMs = (nextFrameTime > now) ? static_cast<unsigned>((nextFrameTime - now) / 1000000ULL) : 0;
+    glutTimerFunc(delayMs, updateScene, 0);
+}
+
 
+// main function
+int main(int argc, char** argv)
+{
     // initialize OpenGL
     glutInit(&argc, argv);
     glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGB | GLUT_DEPTH);
     glutInitWindowSize(400, 400);
     glutCreateWindow("Buzzy_Bowl UAV Simulation");
 
+    // glutInit removed its own flags, the rest are ours
+    std::string recordPath, replayPath, missionPath, scenarioPath;
+    double dt = 0.0; // 0 = the scenario's physics.dt
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--mesh" && i + 1 < argc)
+        {
+            uavMeshPath = argv[++i];
+        }
+        else if (arg == "--field" && i + 1 < argc)
+        {
+            fieldPath = argv[++i];
+        }
+        else if (arg == "--trace" && i + 1 < argc)
+        {
+            tracePath = argv[++i];
+            traceOnExit = true;
+        }
+        else if (arg == "--record" && i + 1 < argc)
+        {
+            recordPath = argv[++i];
+        }
+        else if (arg == "--replay" && i + 1 < argc)
+        {
+            replayPath = argv[++i];
+        }
+        else if (arg == "--scenario" && i + 1 < argc)
+        {
+            scenarioPath = argv[++i];
+        }
+        else if (arg == "--missions" && i + 1 < argc)
+        {
+            missionPath = argv[++i];
+        }
+        else if (arg == "--dt" && i + 1 < argc)
+        {
+            dt = std::strtod(argv[++i], nullptr);
+        }
+        else if (arg == "--triangle-budget" && i + 1 < argc)
+        {
+            triangleBudget = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--fps" && i + 1 < argc)
+        {
+            renderFps = std::max(0.0, std::strtod(argv[++i], nullptr));
+        }
+    }
+
+    if (!replayPath.empty() && !replay.open(replayPath))
+    {
+        std::cerr << "Could not open trajectory " << replayPath << "\n";
+        return 1;
+    }
+
+    // step the whole swarm every physics.dt (10 ms unless --dt or the scenario
+    // says otherwise) on a pool sized to the core count, left stopped while
+    // replaying; 15 UAVs on the football field (3 x 5 grid, 25 yards apart) unless a
+    // scenario says otherwise
+    Scenario scenario;
+    if (!scenarioPath.empty() && !loadScenario(scenarioPath, scenario))
+    {
+        return 1;
+    }
+    if (missionPath.empty())
+    {
+        missionPath = scenario.missionPath;
+    }
+    if (dt > 0.0)
+    {
+        scenario.params.dt = static_cast<float>(dt);
+    }
+    SwarmState swarm;
+    buildSwarm(scenario, swarm);
+    SwarmSnapshotBuffer snapshotBuffer(swarm.size());
+    snapshots = &snapshotBuffer;
+    SwarmScheduler scheduler(swarm, swarm.params.dt, 0, &snapshotBuffer);
+    physics = &scheduler;
+
+    if (!missionPath.empty())
+    {
+        if (!missions.load(missionPath, swarm.size()))
+        {
+            return 1;
+        }
+        scheduler.setMissions(&missions);
+    }
+
+    // flocking / formation keeping from the scenario
+    SwarmBehaviours behaviours(scenario.flock);
+    if (scenario.formationGroup > 1)
+    {
+        behaviours.captureFormation(swarm, scenario.formationGroup);
+    }
+    if (behaviours.isActive())
+    {
+        scheduler.setBehaviours(&behaviours);
+    }
+
+    if (!recordPath.empty() && !replay.isOpen())
+    {
+        if (recorder.open(recordPath, swarm.size(), swarm.params.dt))
+        {
+            recorder.submit(swarm, 0);
+            scheduler.setRecorder(&recorder);
+        }
+        else
+        {
+            std::cerr << "Could not create " << recordPath << ", not recording\n";
+        }
+    }
+
+    if (!replay.isOpen())
+    {
+        scheduler.start();
+    }
+
+#ifdef FREEGLUT
+    // return from glutMainLoop on window close so the scheduler can shut down
+    glutSetOption(GLUT_ACTION_ON_WINDOW_CLOSE, GLUT_ACTION_GLUTMAINLOOP_RETURNS);
+#endif
+
     initOpenGL();
 
     // set display function
     glutDisplayFunc(display);
+    glutReshapeFunc(reshape);
+    glutKeyboardFunc(keyboard);
+    glutKeyboardUpFunc(keyboardUp);
+    glutMouseFunc(mouse);
+    glutMotionFunc(motion);
+    glutSpecialFunc(specialKeys);
 
-
-    glutTimerFunc(10, updateScene, 0); // start update loop
+    // start update loop
+    if (renderFps > 0.0)
+    {
+        nextFrameTime = Profiler::now();
+        glutTimerFunc(0, updateScene, 0);
+    }
+    else
+    {
+        glutIdleFunc(redrawWhenIdle);
+    }
 
     // start main loop
     glutMainLoop();
+
+    scheduler.stop();
+    scheduler.join();
+    recorder.close();
+    if (traceOnExit)
+    {
+        writeTrace();
+    }
     return 0;
 }
\ No newline at end of file